@@ -4,16 +4,27 @@
 #include <HAL/HAL.h>
 #include <HAL/Graphics.h>
 #include <HAL/Timer.h>
-
-#define NUM_TEST_OPTIONS 3
-#define MAX_HIGH_SCORES 5
-
-// Game states
-typedef enum {
-    GAME_RUNNING,
-    GAME_WIN,
-    GAME_OVER
-} GameState;
+#include <HAL/TermView.h>
+#include <Maze.h>
+#include <MazeGame.h>
+#include <MazeView.h>
+#include <ScoreLog.h>
+
+#define NUM_TEST_OPTIONS 6
+#define MAX_HIGH_SCORES SCORELOG_TABLE_SIZE
+
+// Longest move string accepted in command-line mode
+#define COMMAND_LINE_MAX 32
+// Largest repeat count allowed before a single move letter
+#define MAX_MOVE_REPEAT 99
+
+// Side of the mazes built by the "Random Maze" menu item
+#define RANDOM_MAZE_SIZE 31
+// Enemies in a generated maze
+#define RANDOM_MAZE_ENEMIES 16
+// Percent of the walls between corridors knocked out of a generated maze.
+// A perfect maze has one way to the goal, which this many enemies block.
+#define RANDOM_MAZE_BRAID_PERCENT 25
 
 // Menu states
 typedef enum {
@@ -27,38 +38,76 @@ typedef enum {
 typedef enum {
     CURSOR_0 = 0,
     CURSOR_1 = 1,
-    CURSOR_2 = 2
+    CURSOR_2 = 2,
+    CURSOR_3 = 3,
+    CURSOR_4 = 4,
+    CURSOR_5 = 5
 } Cursor;
 
+// How the enemy moves: always random, mostly chasing, or nearly always chasing
+typedef enum {
+    ENEMY_RANDOM,
+    ENEMY_MIXED,
+    ENEMY_CHASE,
+    NUM_ENEMY_MODES
+} EnemyMode;
+
 // Main application struct
 typedef struct {
     MenuState state;
     Cursor arrow;
     UART_Baudrate baudChoice;
 
-    int player_x, player_y;
-    int enemy_x, enemy_y;
-    int start_x, start_y;
+    // Player, enemies and score; the rules live in MazeGame.c
+    MazeGame* game_p;
+
+    // How the maze was made, for the replay log; size 0 is a level from the
+    // pack and the seed its index
+    int mazeSize;
+    uint32_t mazeSeed;
 
-    int borderOffsetX, borderOffsetY;
-    int blockWidth, blockHeight;
+    // Level that "Play Game" starts, counted from 0
+    int level;
+
+    // Time since the game started, for the replay log
+    SWTimer gameClock;
+
+    // Auto-baud re-measures the host rate whenever garbage arrives
+    bool autoBaud;
+    bool autoBaudMeasuring;
+
+    EnemyMode enemyMode;
+
+    // LCD maze window; it owns the camera and repaints only changed cells
+    MazeView view;
+    int movesShown;
 
     bool firstCall;
     bool gamePromptSent;
-    bool mazeDrawn;
     bool gameEndScreenShown;
 
     int highScores[MAX_HIGH_SCORES];
 
-    int moveCount;
-    GameState gameState;
+    // Command-line mode buffers a whole move string until Enter
+    bool commandLineMode;
+    char commandLine[COMMAND_LINE_MAX + 1];
+    int commandLength;
+
+    // Maze view on the terminal, toggled with 't' during a game
+    bool termView;
+    bool termMessageShown;
+    TermView* term_p;
+    int termCameraX, termCameraY;
 
 } Application;
 
 // Core functions
-Application Application_construct(void);
+void Application_init(Application* app_p);
+void Application_useMaze(Application* app, const Maze* maze);
 void Application_loop(Application* app, HAL* hal);
 void Application_updateCommunications(Application* app, HAL* hal);
+void Application_updateAutoBaud(Application* app, HAL* hal);
+void Application_showBaudLED(Application* app, HAL* hal);
 char Application_interpretIncomingChar(char);
 uint32_t CircularIncrement(uint32_t value, uint32_t maximum);
 
@@ -76,25 +125,30 @@ void App_Screen_handleGameScreen(Application* app, HAL* hal);
 
 // Screen update functions
 void App_Screen_updatemainmenu(Application* app, GFX* gfx);
-void App_Screen_updateGameScreen(Application* app, GFX* gfx, int new_x, int new_y);
-void App_Screen_updateEnemy(Application* app, GFX* gfx, int new_x, int new_y);
+void App_Screen_refresh(Application* app, GFX* gfx, const uint16_t* oldEnemyCells);
 
 void App_Screen_showGameWin(Application* app, GFX* gfx);
 void App_Screen_showGameOver(Application* app, GFX* gfx);
 
 // Game logic
-void showMaze(Application* app, GFX* gfx);
-bool isValidMove(Application* app, GFX* gfx, int new_x, int new_y);
-bool isenemyValidMove(Application* app, GFX* gfx, int new_x, int new_y);
+void App_Term_show(Application* app);
+void App_Term_update(Application* app, int oldPlayer_x, int oldPlayer_y,
+                     const uint16_t* oldEnemyCells);
+void App_Term_message(Application* app, const char* text);
+void App_Term_showCommandLine(Application* app);
 
 // Input and movement
-bool isValidPlayerCommand(char c);
 void processPlayerCommand(Application* app, HAL* hal, char rxChar);
-void moveEnemy(Application* app, HAL* hal);
+void handleCommandLineChar(Application* app, HAL* hal, char rxChar);
+void runMoveString(Application* app, HAL* hal, const char* moves);
+void sendInputLog(Application* app, HAL* hal);
 void resetGame(Application* app, HAL* hal);
-void showNextMovePrompt(HAL* hal);
-void notifyInvalidMove(HAL* hal);
-void notifyInvalidInput(HAL* hal);
-void sortHighScores(Application* app_p);
+void startRandomMaze(Application* app, HAL* hal);
+void startLevel(Application* app, HAL* hal);
+void toggleTermView(Application* app, HAL* hal);
+void showNextMovePrompt(Application* app, HAL* hal);
+void notifyInvalidMove(Application* app, HAL* hal);
+void notifyInvalidInput(Application* app, HAL* hal);
+void loadHighScores(Application* app_p);
 
 #endif /* APPLICATION_H_ */
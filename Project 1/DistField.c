@@ -0,0 +1,140 @@
+/*
+ * DistField.c - Breadth-first distance field over a maze
+ */
+
+#include <DistField.h>
+
+static const int8_t stepX[4] = { 0, 0, -1, 1 };
+static const int8_t stepY[4] = { -1, 1, 0, 0 };
+
+// Forget all distances and track a new maze
+void DistField_init(DistField* field_p, const Maze* maze_p) {
+    int i;
+    int cells = maze_p->width * maze_p->height;
+
+    field_p->maze_p = maze_p;
+    for (i = 0; i < cells; i++) {
+        field_p->dist[i] = DISTFIELD_UNREACHED;
+    }
+
+    field_p->head = 0;
+    field_p->tail = 0;
+    field_p->sourceX = -1;
+    field_p->sourceY = -1;
+    field_p->complete = false;
+}
+
+// Start a new pass from (x, y)
+void DistField_setSource(DistField* field_p, int x, int y) {
+    if (x == field_p->sourceX && y == field_p->sourceY) {
+        return;
+    }
+
+    DistField_restart(field_p, x, y);
+}
+
+// Start a new pass from (x, y) even if that is already the source
+void DistField_restart(DistField* field_p, int x, int y) {
+    const Maze* maze_p = field_p->maze_p;
+    int words = (maze_p->width * maze_p->height + 31) / 32;
+    int i;
+    for (i = 0; i < words; i++) {
+        field_p->visited[i] = 0;
+    }
+
+    int source = y * maze_p->width + x;
+    field_p->visited[source >> 5] |= 1u << (source & 31);
+    field_p->dist[source] = 0;
+    field_p->queue[0] = source;
+    field_p->head = 0;
+    field_p->tail = 1;
+
+    field_p->sourceX = x;
+    field_p->sourceY = y;
+    field_p->complete = false;
+}
+
+// Expand up to budget cells of the current pass
+bool DistField_update(DistField* field_p, int budget) {
+    const Maze* maze_p = field_p->maze_p;
+
+    while (budget > 0 && field_p->head < field_p->tail) {
+        int cell = field_p->queue[field_p->head++];
+        int x = cell % maze_p->width;
+        int y = cell / maze_p->width;
+        uint16_t next = field_p->dist[cell] + 1;
+        int d;
+
+        for (d = 0; d < 4; d++) {
+            int nx = x + stepX[d];
+            int ny = y + stepY[d];
+            if (Maze_isWall(maze_p, nx, ny)) {
+                continue;
+            }
+
+            int neighbor = ny * maze_p->width + nx;
+            uint32_t bit = 1u << (neighbor & 31);
+            if (field_p->visited[neighbor >> 5] & bit) {
+                continue;
+            }
+
+            field_p->visited[neighbor >> 5] |= bit;
+            field_p->dist[neighbor] = next;
+            field_p->queue[field_p->tail++] = neighbor;
+        }
+
+        budget--;
+    }
+
+    field_p->complete = field_p->head >= field_p->tail;
+    return field_p->complete;
+}
+
+// Pick the open neighbor of (x, y) closest to the source
+bool DistField_stepToward(const DistField* field_p, int x, int y, int* new_x, int* new_y) {
+    uint16_t best = DISTFIELD_UNREACHED;
+    bool found = false;
+    int d;
+
+    for (d = 0; d < 4; d++) {
+        int nx = x + stepX[d];
+        int ny = y + stepY[d];
+        if (Maze_isWall(field_p->maze_p, nx, ny)) {
+            continue;
+        }
+
+        // Ties and unreached neighbors still count, so there is always a step
+        uint16_t dist = DistField_at(field_p, nx, ny);
+        if (!found || dist < best) {
+            best = dist;
+            *new_x = nx;
+            *new_y = ny;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+// Same step for a cell index, through the move masks
+int DistField_nextCell(const DistField* field_p, const MoveMask* moves_p, int cell) {
+    uint8_t mask = MoveMask_at(moves_p, cell);
+    uint16_t best = DISTFIELD_UNREACHED;
+    int next = -1;
+    int d;
+
+    for (d = 0; d < 4; d++) {
+        if (!((mask >> d) & 1)) {
+            continue;
+        }
+
+        // Ties and unreached neighbors still count, as in stepToward
+        int neighbor = cell + moves_p->delta[d];
+        if (next < 0 || field_p->dist[neighbor] < best) {
+            best = field_p->dist[neighbor];
+            next = neighbor;
+        }
+    }
+
+    return next;
+}
@@ -0,0 +1,67 @@
+/*
+ * DistField.h - Breadth-first distance field over a maze
+ *
+ * Holds the number of steps from every open cell to a source cell (the
+ * player). The field is rebuilt as a resumable BFS wavefront: changing the
+ * source only restarts it, and each DistField_update call advances it by a
+ * fixed number of cells, so the cost per call does not grow with the maze.
+ * Until a pass finishes, cells it has not reached keep their previous value,
+ * which is off by at most the few steps the source moved meanwhile.
+ */
+
+#ifndef DISTFIELD_H_
+#define DISTFIELD_H_
+
+#include <MoveMask.h>
+
+// Largest field, matching the largest generated maze
+#define DISTFIELD_MAX_CELLS (MAZE_GEN_MAX * MAZE_GEN_MAX)
+
+// Distance of cells no pass has reached yet
+#define DISTFIELD_UNREACHED 0xFFFF
+
+// Cells expanded per enemy turn in the game
+#define DISTFIELD_BUDGET 128
+
+typedef struct {
+    const Maze* maze_p;
+    uint16_t dist[DISTFIELD_MAX_CELLS];
+
+    // Wavefront of the current pass; every cell is queued at most once
+    uint32_t visited[DISTFIELD_MAX_CELLS / 32];
+    uint16_t queue[DISTFIELD_MAX_CELLS];
+    int head, tail;
+
+    int sourceX, sourceY;
+    bool complete;
+} DistField;
+
+// Forget all distances and track a new maze
+void DistField_init(DistField* field_p, const Maze* maze_p);
+
+// Start a new pass from (x, y); does nothing if that is already the source
+void DistField_setSource(DistField* field_p, int x, int y);
+
+// Start a new pass from (x, y) even if that is already the source
+void DistField_restart(DistField* field_p, int x, int y);
+
+// Expand up to budget cells of the current pass; returns true once it is done
+bool DistField_update(DistField* field_p, int budget);
+
+// Pick the open neighbor of (x, y) closest to the source.
+// Returns false if (x, y) has no open neighbor.
+bool DistField_stepToward(const DistField* field_p, int x, int y, int* new_x, int* new_y);
+
+// Same step for a cell index, testing neighbors through the maze's move
+// masks. Returns the next cell, or -1 if cell has no open neighbor.
+int DistField_nextCell(const DistField* field_p, const MoveMask* moves_p, int cell);
+
+static inline uint16_t DistField_at(const DistField* field_p, int x, int y) {
+    const Maze* maze_p = field_p->maze_p;
+    if ((unsigned)x >= maze_p->width || (unsigned)y >= maze_p->height) {
+        return DISTFIELD_UNREACHED;
+    }
+    return field_p->dist[y * maze_p->width + x];
+}
+
+#endif /* DISTFIELD_H_ */
@@ -0,0 +1,103 @@
+/*
+ * EnemySet.c - All enemies of a maze game, stored structure-of-arrays
+ */
+
+#include <EnemySet.h>
+
+static void setOccupied(EnemySet* set_p, int cell, bool occupied) {
+    if (occupied) {
+        set_p->occupied[cell >> 5] |= 1u << (cell & 31);
+    } else {
+        set_p->occupied[cell >> 5] &= ~(1u << (cell & 31));
+    }
+}
+
+// Remove all enemies and track a new maze
+void EnemySet_clear(EnemySet* set_p, const MoveMask* moves_p) {
+    const Maze* maze_p = moves_p->maze_p;
+    int words = (maze_p->width * maze_p->height + 31) / 32;
+    int i;
+
+    set_p->maze_p = maze_p;
+    set_p->moves_p = moves_p;
+    set_p->count = 0;
+    for (i = 0; i < words; i++) {
+        set_p->occupied[i] = 0;
+    }
+}
+
+// Restart the random sequence of the set
+void EnemySet_seed(EnemySet* set_p, uint32_t seed) {
+    // xorshift32 stays at zero forever, so map that seed elsewhere
+    set_p->random = seed ? seed : 0x9E3779B9;
+}
+
+// Add an enemy on an open, empty cell
+bool EnemySet_add(EnemySet* set_p, int x, int y, EnemyBehavior behavior, int speed) {
+    if (set_p->count >= MAX_ENEMIES || Maze_isWall(set_p->maze_p, x, y) ||
+        EnemySet_isOccupied(set_p, x, y)) {
+        return false;
+    }
+
+    int i = set_p->count++;
+    set_p->cell[i] = EnemySet_cellOf(set_p, x, y);
+    set_p->lastCell[i] = set_p->cell[i];
+    set_p->behavior[i] = behavior;
+    set_p->speed[i] = speed;
+    setOccupied(set_p, set_p->cell[i], true);
+
+    return true;
+}
+
+// Pick the next cell for enemy i; stays put when boxed in
+static int pickStep(EnemySet* set_p, const DistField* field_p, int i, int cell,
+                    uint32_t chasePercent) {
+    if (set_p->behavior[i] == ENEMY_HUNTER && (EnemySet_random(set_p) % 100) < chasePercent) {
+        int next = DistField_nextCell(field_p, set_p->moves_p, cell);
+        if (next >= 0) {
+            return next;
+        }
+    }
+
+    // Wander to a uniformly chosen open neighbor; no retries into walls
+    uint8_t mask = MoveMask_at(set_p->moves_p, cell);
+    int count = MoveMask_count(mask);
+    if (count == 0) {
+        return cell;
+    }
+
+    MoveDir dir = MoveMask_select(mask, EnemySet_random(set_p) % count);
+    return cell + set_p->moves_p->delta[dir];
+}
+
+// Move every enemy; returns true if one stepped onto the player
+bool EnemySet_takeTurn(EnemySet* set_p, const DistField* field_p,
+                       int player_x, int player_y, uint32_t chasePercent) {
+    int playerCell = EnemySet_cellOf(set_p, player_x, player_y);
+    bool caught = false;
+    int i, step;
+
+    for (i = 0; i < set_p->count; i++) {
+        set_p->lastCell[i] = set_p->cell[i];
+
+        for (step = 0; step < set_p->speed[i]; step++) {
+            int next = pickStep(set_p, field_p, i, set_p->cell[i], chasePercent);
+
+            // Enemies queue up behind each other instead of stacking; a boxed
+            // in enemy finds its own cell occupied and stays
+            if (EnemySet_isCellOccupied(set_p, next)) {
+                break;
+            }
+
+            setOccupied(set_p, set_p->cell[i], false);
+            set_p->cell[i] = next;
+            setOccupied(set_p, next, true);
+
+            if (next == playerCell) {
+                caught = true;
+            }
+        }
+    }
+
+    return caught;
+}
@@ -0,0 +1,80 @@
+/*
+ * EnemySet.h - All enemies of a maze game, stored structure-of-arrays
+ *
+ * Each enemy is a maze cell index (y * width + x) plus a behavior and a
+ * speed in parallel arrays, so a turn is one pass over small arrays. A
+ * bitmap with one bit per cell marks occupied cells, which makes "is there
+ * an enemy here" a single bit test for collisions and for drawing. The set
+ * draws its random steps from its own seeded generator, so the same seed and
+ * player moves always give the same enemy moves. Turns work on cell indices
+ * and the maze's move masks (MoveMask.h), never on x/y coordinates.
+ */
+
+#ifndef ENEMYSET_H_
+#define ENEMYSET_H_
+
+#include <DistField.h>
+
+#define MAX_ENEMIES 32
+
+typedef enum {
+    ENEMY_WANDERER,  // always steps to a random open neighbor
+    ENEMY_HUNTER     // follows the distance field some of the time
+} EnemyBehavior;
+
+typedef struct {
+    const Maze* maze_p;
+    const MoveMask* moves_p;
+    int count;
+
+    uint16_t cell[MAX_ENEMIES];
+    uint16_t lastCell[MAX_ENEMIES];  // cell before the latest turn
+    uint8_t behavior[MAX_ENEMIES];
+    uint8_t speed[MAX_ENEMIES];      // steps per turn
+
+    uint32_t occupied[DISTFIELD_MAX_CELLS / 32];
+    uint32_t random;                 // xorshift32 state, never zero
+} EnemySet;
+
+// Remove all enemies and track a new maze, given by its move masks
+void EnemySet_clear(EnemySet* set_p, const MoveMask* moves_p);
+
+// Restart the random sequence of the set
+void EnemySet_seed(EnemySet* set_p, uint32_t seed);
+
+// Add an enemy on an open, empty cell; returns false if it cannot
+bool EnemySet_add(EnemySet* set_p, int x, int y, EnemyBehavior behavior, int speed);
+
+// Move every enemy. Hunters chase chasePercent of their steps; an enemy
+// never steps onto another. Returns true if one stepped onto the player.
+bool EnemySet_takeTurn(EnemySet* set_p, const DistField* field_p,
+                       int player_x, int player_y, uint32_t chasePercent);
+
+static inline int EnemySet_cellOf(const EnemySet* set_p, int x, int y) {
+    return y * set_p->maze_p->width + x;
+}
+
+// Next number from the set's generator (xorshift32)
+static inline uint32_t EnemySet_random(EnemySet* set_p) {
+    uint32_t x = set_p->random;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    set_p->random = x;
+    return x;
+}
+
+// Whether an enemy stands on a cell index inside the maze
+static inline bool EnemySet_isCellOccupied(const EnemySet* set_p, int cell) {
+    return (set_p->occupied[cell >> 5] >> (cell & 31)) & 1;
+}
+
+// Whether an enemy stands on (x, y); cells outside the maze are empty
+static inline bool EnemySet_isOccupied(const EnemySet* set_p, int x, int y) {
+    if ((unsigned)x >= set_p->maze_p->width || (unsigned)y >= set_p->maze_p->height) {
+        return false;
+    }
+    return EnemySet_isCellOccupied(set_p, EnemySet_cellOf(set_p, x, y));
+}
+
+#endif /* ENEMYSET_H_ */
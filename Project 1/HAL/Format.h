@@ -0,0 +1,31 @@
+/*
+ * Format.h - Small number formatting without printf
+ */
+
+#ifndef HAL_FORMAT_H_
+#define HAL_FORMAT_H_
+
+#include <stdint.h>
+
+// Longest decimal text: sign, 10 digits and the terminator
+#define FORMAT_MAX_INT_LEN 12
+
+// Each formatter writes a terminated string into buf and returns its length,
+// so calls can be chained with p += Format_xxx(p, ...)
+
+// Copy a string
+int Format_string(char* buf, const char* str);
+
+// Unsigned decimal, padded on the left with pad up to width characters
+int Format_uint(char* buf, uint32_t value, int width, char pad);
+
+// Signed decimal, padded on the left with pad up to width characters
+int Format_int(char* buf, int32_t value, int width, char pad);
+
+// Hexadecimal with exactly digits digits (1 to 8), upper case
+int Format_hex(char* buf, uint32_t value, int digits);
+
+// Signed fixed-point value with fracBits fractional bits, rounded to decimals places
+int Format_fixed(char* buf, int32_t value, int fracBits, int decimals);
+
+#endif /* HAL_FORMAT_H_ */
@@ -2,6 +2,7 @@
  * Graphics.c - Display drawing functions
  */
 
+#include <HAL/Format.h>
 #include <HAL/Graphics.h>
 
 // Initialize display and graphics context
@@ -49,6 +50,14 @@ void GFX_print(GFX* gfx_p, char* string, int row, int col)
     Graphics_drawString(&gfx_p->context, (int8_t*) string, -1, xPosition, yPosition, OPAQUE_TEXT);
 }
 
+// Print a signed number at row and column
+void GFX_printInt(GFX* gfx_p, int32_t value, int width, int row, int col)
+{
+    char text[FORMAT_MAX_INT_LEN];
+    Format_int(text, value, width, ' ');
+    GFX_print(gfx_p, text, row, col);
+}
+
 // Set foreground color
 void GFX_setForeground(GFX* gfx_p, uint32_t foreground)
 {
@@ -105,10 +114,16 @@ void GFX_drawSolidRectangle(GFX* gfx_p, int j, int k, int blockWidth, int blockH
     Graphics_fillRectangle(&gfx_p->context, &rec);
 }
 
+// Draw a two-color block with a single window write instead of layered fills
+void GFX_drawMaskedBlock(GFX* gfx_p, int x, int y, int width, int height,
+                         const uint16_t* mask, uint32_t fg, uint32_t bg)
+{
+    Crystalfontz128x128_DrawMaskedBlock(x, y, width, height, mask, fg, bg);
+}
+
 // Display move count on screen
 void GFX_displayMoveCount(GFX* gfx_p, int moveCount) {
-    char movesText[20];
     GFX_setForeground(gfx_p, FG_COLOR);
-    snprintf(movesText, sizeof(movesText), "Moves: %d", moveCount);
-    GFX_print(gfx_p, movesText, 2, 3);
+    GFX_print(gfx_p, "Moves: ", 2, 3);
+    GFX_printInt(gfx_p, moveCount, 0, 2, 10);
 }
@@ -38,6 +38,9 @@ void GFX_clear(GFX* gfx_p);
 // Print text at row and column
 void GFX_print(GFX* gfx_p, char* string, int row, int col);
 
+// Print a signed number at row and column, space padded to width
+void GFX_printInt(GFX* gfx_p, int32_t value, int width, int row, int col);
+
 // Set drawing color
 void GFX_setForeground(GFX* gfx_p, uint32_t foreground);
 
@@ -59,4 +62,8 @@ void GFX_removeHollowCircle(GFX* gfx_p, int x, int y, int radius);
 // Draw filled rectangle
 void GFX_drawSolidRectangle(GFX* gfx_p, int j, int k, int blockWidth, int blockHeight);
 
+// Draw a block in one LCD write; set mask bits (bit 0 leftmost) are fg, the rest bg
+void GFX_drawMaskedBlock(GFX* gfx_p, int x, int y, int width, int height,
+                         const uint16_t* mask, uint32_t fg, uint32_t bg);
+
 #endif /* HAL_GRAPHICS_H_ */
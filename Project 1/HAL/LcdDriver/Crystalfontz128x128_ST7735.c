@@ -38,6 +38,7 @@
 
 #include <HAL/LcdDriver/Crystalfontz128x128_ST7735.h>
 #include <HAL/LcdDriver/HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h>
+#include <HAL/LcdMirror.h>
 #include <stdint.h>
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
 #include <ti/grlib/grlib.h>
@@ -213,6 +214,7 @@ static void Crystalfontz128x128_PixelDraw(const Graphics_Display *pDisplay,
   HAL_LCD_writeCommand(CM_RAMWR);
   HAL_LCD_writeData(ulValue >> 8);
   HAL_LCD_writeData(ulValue);
+  LCD_MIRROR_FILL(lX, lY, lX, lY, ulValue);
 }
 
 //*****************************************************************************
@@ -251,6 +253,7 @@ static void Crystalfontz128x128_PixelDrawMultiple(
   //
   Crystalfontz128x128_SetDrawFrame(lX, lY, lX + lCount, 127);
   HAL_LCD_writeCommand(CM_RAMWR);
+  LCD_MIRROR_BEGIN_ROW(lX, lY);
 
   //
   // Determine how to interpret the pixel data based on the number of bits
@@ -270,6 +273,7 @@ static void Crystalfontz128x128_PixelDrawMultiple(
           HAL_LCD_writeData(
               (((uint32_t *)pucPalette)[(Data >> (7 - lX0)) & 1]) >> 8);
           HAL_LCD_writeData(((uint32_t *)pucPalette)[(Data >> (7 - lX0)) & 1]);
+          LCD_MIRROR_PIXEL(((uint32_t *)pucPalette)[(Data >> (7 - lX0)) & 1]);
         }
 
         // Start at the beginning of the next byte of image data
@@ -300,6 +304,7 @@ static void Crystalfontz128x128_PixelDrawMultiple(
             // Write to LCD screen
             HAL_LCD_writeData(Data >> 8);
             HAL_LCD_writeData(Data);
+            LCD_MIRROR_PIXEL(Data);
 
             // Decrement the count of pixels to draw
             lCount--;
@@ -315,6 +320,7 @@ static void Crystalfontz128x128_PixelDrawMultiple(
                 // Write to LCD screen
                 HAL_LCD_writeData(Data >> 8);
                 HAL_LCD_writeData(Data);
+                LCD_MIRROR_PIXEL(Data);
 
                 // Decrement the count of pixels to draw
                 lCount--;
@@ -337,6 +343,7 @@ static void Crystalfontz128x128_PixelDrawMultiple(
         // Write to LCD screen
         HAL_LCD_writeData(Data >> 8);
         HAL_LCD_writeData(Data);
+        LCD_MIRROR_PIXEL(Data);
       }
       // The image data has been drawn
       break;
@@ -362,9 +369,11 @@ static void Crystalfontz128x128_PixelDrawMultiple(
         // Translate this palette entry and write it to the screen
         HAL_LCD_writeData(usData >> 8);
         HAL_LCD_writeData(usData);
+        LCD_MIRROR_PIXEL(usData);
       }
     }
   }
+  LCD_MIRROR_END_ROW();
 }
 
 //*****************************************************************************
@@ -398,6 +407,7 @@ static void Crystalfontz128x128_LineDrawH(const Graphics_Display *pDisplay,
     HAL_LCD_writeData(ulValue >> 8);
     HAL_LCD_writeData(ulValue);
   }
+  LCD_MIRROR_FILL(lX1, lY, lX2, lY, ulValue);
 }
 
 //*****************************************************************************
@@ -431,6 +441,7 @@ static void Crystalfontz128x128_LineDrawV(const Graphics_Display *pDisplay,
     HAL_LCD_writeData(ulValue >> 8);
     HAL_LCD_writeData(ulValue);
   }
+  LCD_MIRROR_FILL(lX, lY1, lX, lY2, ulValue);
 }
 
 //*****************************************************************************
@@ -470,6 +481,7 @@ static void Crystalfontz128x128_RectFill(const Graphics_Display *pDisplay,
     HAL_LCD_writeData(ulValue >> 8);
     HAL_LCD_writeData(ulValue);
   }
+  LCD_MIRROR_FILL(x0, y0, x1, y1, ulValue);
 }
 
 //*****************************************************************************
@@ -538,6 +550,50 @@ static void Crystalfontz128x128_ClearScreen(const Graphics_Display *pDisplay,
   Crystalfontz128x128_RectFill(pDisplay, &rect, ulValue);
 }
 
+//*****************************************************************************
+//
+//! Draws a block of two-color pixels in one window write.
+//!
+//! \param x is the X coordinate of the upper left corner of the block.
+//! \param y is the Y coordinate of the upper left corner of the block.
+//! \param w is the width of the block, at most 16 pixels.
+//! \param h is the height of the block.
+//! \param mask holds one row per entry; bit 0 is the leftmost pixel, and
+//! a set bit draws the foreground color.  A NULL mask fills with background.
+//! \param fg is the 24-bit RGB foreground color.
+//! \param bg is the 24-bit RGB background color.
+//!
+//! This function lets callers compose a cell (background plus sprite) and
+//! send it with a single frame setup instead of a fill followed by a shape
+//! drawn on top, so the panel never shows the half-drawn cell.
+//!
+//! \return None.
+//
+//*****************************************************************************
+void Crystalfontz128x128_DrawMaskedBlock(int16_t x, int16_t y, int16_t w,
+                                         int16_t h, const uint16_t *mask,
+                                         uint32_t fg, uint32_t bg) {
+  uint16_t fgValue = Crystalfontz128x128_ColorTranslate(0, fg);
+  uint16_t bgValue = Crystalfontz128x128_ColorTranslate(0, bg);
+  int16_t row, col;
+
+  Crystalfontz128x128_SetDrawFrame(x, y, x + w - 1, y + h - 1);
+  HAL_LCD_writeCommand(CM_RAMWR);
+
+  for (row = 0; row < h; row++) {
+    uint16_t bits = mask ? mask[row] : 0;
+
+    LCD_MIRROR_BEGIN_ROW(x, y + row);
+    for (col = 0; col < w; col++) {
+      uint16_t value = (bits >> col) & 1 ? fgValue : bgValue;
+      HAL_LCD_writeData(value >> 8);
+      HAL_LCD_writeData(value);
+      LCD_MIRROR_PIXEL(value);
+    }
+    LCD_MIRROR_END_ROW();
+  }
+}
+
 //*****************************************************************************
 //
 //! The display structure that describes the driver for the Kitronix
@@ -108,4 +108,9 @@ extern void Crystalfontz128x128_SetDrawFrame(uint16_t x0, uint16_t y0,
 
 extern void Crystalfontz128x128_SetOrientation(uint8_t orientation);
 
+extern void Crystalfontz128x128_DrawMaskedBlock(int16_t x, int16_t y,
+                                                int16_t w, int16_t h,
+                                                const uint16_t *mask,
+                                                uint32_t fg, uint32_t bg);
+
 #endif /* __CRYSTALFONTZLCD_H__ */
@@ -0,0 +1,145 @@
+/*
+ * LcdMirror.c - Streams LCD drawing over UART for a host viewer
+ */
+
+#include <HAL/LcdMirror.h>
+#include <HAL/LcdDriver/Crystalfontz128x128_ST7735.h>
+
+// The screen is tracked as 16x16 tiles of 8x8 pixels
+#define TILE_SHIFT 3
+#define TILES_PER_ROW (LCD_HORIZONTAL_MAX >> TILE_SHIFT)
+#define TILE_COUNT (TILES_PER_ROW * (LCD_VERTICAL_MAX >> TILE_SHIFT))
+
+static UART* mirrorUart = NULL;
+
+// Color of each tile that is known to be a single color on the host
+static uint16_t tileColor[TILE_COUNT];
+static uint32_t tileUniform[TILE_COUNT / 32];
+
+// Set when a packet could not be queued
+static bool dropped = false;
+
+// Current pixel run for row bursts
+static int16_t runX, runY, runLength;
+static uint16_t runColor;
+
+static bool isUniform(int tile) {
+    return (tileUniform[tile >> 5] >> (tile & 31)) & 1;
+}
+
+static void setUniform(int tile, uint16_t color) {
+    tileUniform[tile >> 5] |= 1u << (tile & 31);
+    tileColor[tile] = color;
+}
+
+static void clearUniform(int tile) {
+    tileUniform[tile >> 5] &= ~(1u << (tile & 31));
+}
+
+// Start mirroring to a UART
+void LcdMirror_attach(UART* uart_p) {
+    int i;
+    for (i = 0; i < TILE_COUNT / 32; i++) {
+        tileUniform[i] = 0;
+    }
+    dropped = false;
+    runLength = 0;
+    mirrorUart = uart_p;
+}
+
+// Forward a fill unless every tile it touches already holds that color
+void LcdMirror_fill(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (mirrorUart == NULL) {
+        return;
+    }
+
+    // The driver assumes on-screen coordinates; clip anyway to keep tiles valid
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > LCD_HORIZONTAL_MAX - 1) x1 = LCD_HORIZONTAL_MAX - 1;
+    if (y1 > LCD_VERTICAL_MAX - 1) y1 = LCD_VERTICAL_MAX - 1;
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+
+    int tx0 = x0 >> TILE_SHIFT;
+    int ty0 = y0 >> TILE_SHIFT;
+    int tx1 = x1 >> TILE_SHIFT;
+    int ty1 = y1 >> TILE_SHIFT;
+    int tx, ty;
+
+    bool changed = false;
+    for (ty = ty0; ty <= ty1 && !changed; ty++) {
+        for (tx = tx0; tx <= tx1; tx++) {
+            int tile = ty * TILES_PER_ROW + tx;
+            if (!isUniform(tile) || tileColor[tile] != color) {
+                changed = true;
+                break;
+            }
+        }
+    }
+    if (!changed) {
+        return;
+    }
+
+    // Queue the whole packet or nothing, so the stream never desyncs
+    bool fits = UART_txFree(mirrorUart) >= LCD_MIRROR_FILL_PACKET_SIZE + (dropped ? 2 : 0);
+    if (fits) {
+        if (dropped) {
+            UART_sendChar(mirrorUart, (char)LCD_MIRROR_SYNC);
+            UART_sendChar(mirrorUart, 'D');
+            dropped = false;
+        }
+        UART_sendChar(mirrorUart, (char)LCD_MIRROR_SYNC);
+        UART_sendChar(mirrorUart, 'F');
+        UART_sendChar(mirrorUart, (char)x0);
+        UART_sendChar(mirrorUart, (char)y0);
+        UART_sendChar(mirrorUart, (char)x1);
+        UART_sendChar(mirrorUart, (char)y1);
+        UART_sendChar(mirrorUart, (char)(color >> 8));
+        UART_sendChar(mirrorUart, (char)color);
+    } else {
+        dropped = true;
+    }
+
+    // Tiles fully covered become that color; partly covered ones become unknown.
+    // A dropped fill leaves every touched tile unknown so the next draw resends.
+    for (ty = ty0; ty <= ty1; ty++) {
+        for (tx = tx0; tx <= tx1; tx++) {
+            int tile = ty * TILES_PER_ROW + tx;
+            bool covered = x0 <= (tx << TILE_SHIFT) && x1 >= (tx << TILE_SHIFT) + 7 &&
+                           y0 <= (ty << TILE_SHIFT) && y1 >= (ty << TILE_SHIFT) + 7;
+            if (fits && covered) {
+                setUniform(tile, color);
+            } else if (!fits || tileColor[tile] != color) {
+                clearUniform(tile);
+            }
+        }
+    }
+}
+
+// Start a run-length encoded pixel burst
+void LcdMirror_beginRow(int16_t x, int16_t y) {
+    runX = x;
+    runY = y;
+    runLength = 0;
+}
+
+// Extend the current run or flush it when the color changes
+void LcdMirror_pixel(uint16_t color) {
+    if (runLength > 0 && color != runColor) {
+        LcdMirror_fill(runX, runY, runX + runLength - 1, runY, runColor);
+        runX += runLength;
+        runLength = 0;
+    }
+    runColor = color;
+    runLength++;
+}
+
+// Flush the last run of a burst
+void LcdMirror_endRow(void) {
+    if (runLength > 0) {
+        LcdMirror_fill(runX, runY, runX + runLength - 1, runY, runColor);
+        runLength = 0;
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * LcdMirror.h - Streams LCD drawing over UART for a host viewer
+ *
+ * Every fill the Crystalfontz driver performs is forwarded as a packet:
+ *
+ *   0xA5 'F' x0 y0 x1 y1 colorHi colorLo    fill inclusive rectangle (RGB565)
+ *   0xA5 'D'                                packets were dropped, image may be stale
+ *
+ * Pixel bursts are run-length encoded into one fill per run. Packets share the
+ * UART with normal ASCII text, so a viewer treats 0xA5 as the start of a packet
+ * and everything else as terminal output. An 8x8 tile cache skips fills that
+ * would not change any pixel, so only changed regions are sent.
+ */
+
+#ifndef HAL_LCDMIRROR_H_
+#define HAL_LCDMIRROR_H_
+
+#include <HAL/UART.h>
+#include <stdint.h>
+
+// Build with LCD_MIRROR_ENABLED=1 to add the tap to the LCD driver
+#ifndef LCD_MIRROR_ENABLED
+#define LCD_MIRROR_ENABLED 0
+#endif
+
+#define LCD_MIRROR_SYNC 0xA5
+#define LCD_MIRROR_FILL_PACKET_SIZE 8
+
+// Start mirroring to a UART; the host image is treated as unknown
+void LcdMirror_attach(UART* uart_p);
+
+// Forward a solid fill of the inclusive rectangle
+void LcdMirror_fill(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+// Run-length encode a horizontal burst of pixels starting at (x, y)
+void LcdMirror_beginRow(int16_t x, int16_t y);
+void LcdMirror_pixel(uint16_t color);
+void LcdMirror_endRow(void);
+
+// Driver hooks compile away when mirroring is off
+#if LCD_MIRROR_ENABLED
+#define LCD_MIRROR_FILL(x0, y0, x1, y1, color) LcdMirror_fill(x0, y0, x1, y1, color)
+#define LCD_MIRROR_BEGIN_ROW(x, y) LcdMirror_beginRow(x, y)
+#define LCD_MIRROR_PIXEL(color) LcdMirror_pixel(color)
+#define LCD_MIRROR_END_ROW() LcdMirror_endRow()
+#else
+#define LCD_MIRROR_FILL(x0, y0, x1, y1, color)
+#define LCD_MIRROR_BEGIN_ROW(x, y)
+#define LCD_MIRROR_PIXEL(color)
+#define LCD_MIRROR_END_ROW()
+#endif
+
+#endif /* HAL_LCDMIRROR_H_ */
@@ -0,0 +1,51 @@
+/*
+ * Random.h - Seeded random number streams
+ *
+ * Each subsystem draws from a stream of its own, so adding a draw to one
+ * never changes what another sees. A stream is xoshiro128**: 128 bits of
+ * state, period 2^128 - 1, a few shifts and one multiply per number.
+ * Stream k of a seed starts 2^64 numbers after stream k - 1, so streams
+ * never overlap in practice.
+ *
+ * The seed is gathered at boot from ADC noise and timer jitter. Building
+ * with RANDOM_FIXED_SEED set to a nonzero value uses that seed instead, so
+ * every boot plays the same sequence for replay and debugging.
+ *
+ * Here the streams only pick seeds for random mazes and for the enemies.
+ * MazeGen and EnemySet keep their own xorshift generators, so a maze or an
+ * input log recorded by an older build still plays back the same.
+ */
+
+#ifndef HAL_RANDOM_H_
+#define HAL_RANDOM_H_
+
+#include <stdint.h>
+
+#ifndef RANDOM_FIXED_SEED
+#define RANDOM_FIXED_SEED 0
+#endif
+
+typedef struct {
+    uint32_t s[4];
+} Random;
+
+// Start stream number stream of seed
+void Random_init(Random* random_p, uint32_t seed, int stream);
+
+// The next 32 random bits
+uint32_t Random_next(Random* random_p);
+
+// Uniform in 0 .. bound - 1 with no modulo bias; bound must not be 0
+uint32_t Random_below(Random* random_p, uint32_t bound);
+
+// Uniform in low .. high inclusive
+int Random_range(Random* random_p, int low, int high);
+
+// A seed from ADC noise and timer jitter. Needs InitSystemTiming, and
+// reconfigures the ADC, so it must run before anything else sets it up.
+uint32_t Random_gatherEntropy(void);
+
+// RANDOM_FIXED_SEED if set, otherwise a seed from Random_gatherEntropy
+uint32_t Random_bootSeed(void);
+
+#endif /* HAL_RANDOM_H_ */
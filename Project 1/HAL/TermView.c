@@ -0,0 +1,156 @@
+/*
+ * TermView.c - ANSI terminal grid view over UART
+ */
+
+#include <HAL/Format.h>
+#include <HAL/TermView.h>
+
+// Send raw bytes without the newline UART_sendString adds
+static void sendRaw(TermView* view_p, const char* str) {
+    while (*str) {
+        if (!UART_waitToSend(view_p->uart_p)) {
+            return;
+        }
+        UART_sendChar(view_p->uart_p, *str);
+        str++;
+    }
+}
+
+// Move the cursor unless it is already there (1-based terminal position)
+static void moveCursor(TermView* view_p, int line, int column) {
+    if (view_p->cursorLine == line && view_p->cursorColumn == column) {
+        return;
+    }
+
+    char seq[16];
+    char* p = seq;
+    p += Format_string(p, "\x1b[");
+    p += Format_int(p, line, 0, ' ');
+    p += Format_string(p, ";");
+    p += Format_int(p, column, 0, ' ');
+    Format_string(p, "H");
+    sendRaw(view_p, seq);
+
+    view_p->cursorLine = line;
+    view_p->cursorColumn = column;
+}
+
+// Change the text color unless it is already set
+static void setColor(TermView* view_p, uint8_t color) {
+    if (view_p->color == color) {
+        return;
+    }
+
+    char seq[8];
+    char* p = seq;
+    p += Format_string(p, "\x1b[");
+    p += Format_uint(p, color, 0, ' ');
+    Format_string(p, "m");
+    sendRaw(view_p, seq);
+
+    view_p->color = color;
+}
+
+static bool sameCell(const TermCell* a, const TermCell* b) {
+    return a->text[0] == b->text[0] && a->text[1] == b->text[1] && a->color == b->color;
+}
+
+// Send one cell and record it in the shadow
+static void drawCell(TermView* view_p, int row, int col, const TermCell* cell) {
+    moveCursor(view_p, row + 1, col * 2 + 1);
+    setColor(view_p, cell->color);
+
+    char text[3] = { cell->text[0], cell->text[1], '\0' };
+    sendRaw(view_p, text);
+    view_p->cursorColumn += 2;
+
+    view_p->shown[row][col] = *cell;
+}
+
+static bool inGrid(TermView* view_p, int row, int col) {
+    return row >= 0 && row < view_p->rows && col >= 0 && col < view_p->cols;
+}
+
+// Set up a view of rows x cols cells drawn through a UART; the grids are
+// filled by TermView_begin
+void TermView_init(TermView* view_p, UART* uart_p, int rows, int cols) {
+    view_p->uart_p = uart_p;
+    view_p->rows = rows > TERMVIEW_MAX_ROWS ? TERMVIEW_MAX_ROWS : rows;
+    view_p->cols = cols > TERMVIEW_MAX_COLS ? TERMVIEW_MAX_COLS : cols;
+    view_p->cursorLine = 0;
+    view_p->cursorColumn = 0;
+    view_p->color = TERM_DEFAULT;
+}
+
+// Clear the terminal and hide the cursor; every cell becomes blank
+void TermView_begin(TermView* view_p) {
+    TermCell blank = { { ' ', ' ' }, TERM_DEFAULT };
+    int row, col;
+
+    for (row = 0; row < view_p->rows; row++) {
+        for (col = 0; col < view_p->cols; col++) {
+            view_p->base[row][col] = blank;
+            view_p->shown[row][col] = blank;
+        }
+    }
+
+    // Reset attributes, clear, home and hide the cursor
+    sendRaw(view_p, "\x1b[0m\x1b[2J\x1b[H\x1b[?25l");
+    view_p->cursorLine = 1;
+    view_p->cursorColumn = 1;
+    view_p->color = TERM_DEFAULT;
+}
+
+// Reset colors, show the cursor and park it below the grid
+void TermView_end(TermView* view_p) {
+    setColor(view_p, TERM_DEFAULT);
+    moveCursor(view_p, view_p->rows + 2 + TERMVIEW_TEXT_LINES, 1);
+    sendRaw(view_p, "\x1b[?25h");
+}
+
+// Set a cell's background and draw it
+void TermView_setBase(TermView* view_p, int row, int col, const char* text, uint8_t color) {
+    if (!inGrid(view_p, row, col)) {
+        return;
+    }
+
+    TermCell cell = { { text[0], text[1] }, color };
+    view_p->base[row][col] = cell;
+    if (!sameCell(&view_p->shown[row][col], &cell)) {
+        drawCell(view_p, row, col, &cell);
+    }
+}
+
+// Draw something on top of a cell; nothing is sent if it already shows that
+void TermView_put(TermView* view_p, int row, int col, const char* text, uint8_t color) {
+    if (!inGrid(view_p, row, col)) {
+        return;
+    }
+
+    TermCell cell = { { text[0], text[1] }, color };
+    if (!sameCell(&view_p->shown[row][col], &cell)) {
+        drawCell(view_p, row, col, &cell);
+    }
+}
+
+// Put a cell back to its background
+void TermView_putBase(TermView* view_p, int row, int col) {
+    if (!inGrid(view_p, row, col)) {
+        return;
+    }
+
+    if (!sameCell(&view_p->shown[row][col], &view_p->base[row][col])) {
+        drawCell(view_p, row, col, &view_p->base[row][col]);
+    }
+}
+
+// Print text on a terminal line below the grid, clearing the rest of the line
+void TermView_print(TermView* view_p, int line, int column, const char* text) {
+    moveCursor(view_p, view_p->rows + 2 + line, column + 1);
+    setColor(view_p, TERM_DEFAULT);
+    sendRaw(view_p, text);
+    sendRaw(view_p, "\x1b[K");
+
+    // Text may hold anything, so stop trusting the column
+    view_p->cursorColumn = 0;
+}
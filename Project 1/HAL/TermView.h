@@ -0,0 +1,71 @@
+/*
+ * TermView.h - ANSI terminal grid view over UART
+ *
+ * The terminal is treated as a grid of cells, each two characters wide so it
+ * looks roughly square. A shadow copy of what the terminal shows lets every
+ * update skip cells that already hold the right text, and the cursor position
+ * and color are tracked so escape sequences are only sent when they change.
+ */
+
+#ifndef HAL_TERMVIEW_H_
+#define HAL_TERMVIEW_H_
+
+#include <HAL/UART.h>
+
+#define TERMVIEW_MAX_ROWS 16
+#define TERMVIEW_MAX_COLS 16
+
+// Text lines kept under the grid for TermView_print
+#define TERMVIEW_TEXT_LINES 3
+
+// ANSI foreground colors (SGR codes)
+#define TERM_DEFAULT 0
+#define TERM_RED 31
+#define TERM_GREEN 32
+#define TERM_YELLOW 33
+#define TERM_BLUE 34
+#define TERM_WHITE 37
+
+// One grid cell: two characters and a color
+typedef struct {
+    char text[2];
+    uint8_t color;
+} TermCell;
+
+// Terminal view struct
+typedef struct {
+    UART* uart_p;
+    int rows, cols;
+
+    // What each cell shows with nothing on it, and what it shows now
+    TermCell base[TERMVIEW_MAX_ROWS][TERMVIEW_MAX_COLS];
+    TermCell shown[TERMVIEW_MAX_ROWS][TERMVIEW_MAX_COLS];
+
+    // Terminal state after the last byte sent (1-based, 0 = unknown)
+    int cursorLine, cursorColumn;
+    uint8_t color;
+} TermView;
+
+// Set up a view of rows x cols cells drawn through a UART
+void TermView_init(TermView* view_p, UART* uart_p, int rows, int cols);
+
+// Clear the terminal and hide the cursor; every cell becomes blank
+void TermView_begin(TermView* view_p);
+
+// Reset colors, show the cursor and park it below the grid
+void TermView_end(TermView* view_p);
+
+// Set a cell's background and draw it
+void TermView_setBase(TermView* view_p, int row, int col, const char* text, uint8_t color);
+
+// Draw something on top of a cell; nothing is sent if it already shows that
+void TermView_put(TermView* view_p, int row, int col, const char* text, uint8_t color);
+
+// Put a cell back to its background
+void TermView_putBase(TermView* view_p, int row, int col);
+
+// Print text on a terminal line below the grid, clearing the rest of the line
+// (line 0 is the first line under the grid, up to TERMVIEW_TEXT_LINES - 1)
+void TermView_print(TermView* view_p, int line, int column, const char* text);
+
+#endif /* HAL_TERMVIEW_H_ */
@@ -64,7 +64,7 @@ uint64_t SWTimer_elapsedCycles(SWTimer* timer_p) {
     uint64_t startCounter = timer_p->startCounter;
     uint64_t currentCounter = Timer32_getValue(TIMER32_0_BASE);
     uint64_t elapsedCycles =
-        (rollovers * (LOADVALUE + 1)) + startCounter - currentCounter;
+        (rollovers * ((uint64_t)LOADVALUE + 1)) + startCounter - currentCounter;
 
     return elapsedCycles;
 }
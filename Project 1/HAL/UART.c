@@ -2,9 +2,25 @@
  * UART.c - Serial communication
  */
 
+#include <HAL/Format.h>
 #include <HAL/Timer.h>
 #include <HAL/UART.h>
 
+// Bits per second for each baud choice
+static const uint32_t baudRateMapping[NUM_BAUD_CHOICES] = {9600, 19200, 38400, 57600};
+
+// Transmit ring drained by the eUSCI TX interrupt
+static volatile uint8_t txRing[UART_TX_RING_SIZE];
+static volatile uint32_t txHead = 0;
+static volatile uint32_t txTail = 0;
+static volatile bool txEnabled = false;
+
+// Auto-baud edge timing, updated from the port interrupt
+static volatile uint32_t autoBaudLastEdge = 0;
+static volatile uint32_t autoBaudMinPulse = 0xFFFFFFFF;
+static volatile uint32_t autoBaudEdges = 0;
+static volatile bool autoBaudFallingNext = true;
+
 // Create and initialize UART
 UART UART_construct(uint32_t moduleInstance, uint32_t port, uint32_t pins) {
     UART uart;
@@ -22,6 +38,8 @@ UART UART_construct(uint32_t moduleInstance, uint32_t port, uint32_t pins) {
     uart.config.msborLsbFirst = EUSCI_A_UART_LSB_FIRST;
     uart.config.uartMode = EUSCI_A_UART_MODE;
 
+    uart.rxError = false;
+
     return uart;
 }
 
@@ -40,6 +58,27 @@ void UART_SetBaud_Enable(UART* uart_p, UART_Baudrate baudChoice) {
 
     UART_initModule(uart_p->moduleInstance, &(uart_p->config));
     UART_enableModule(uart_p->moduleInstance);
+
+    // Re-initializing clears the TX interrupt enable, so restart any pending output
+    txEnabled = true;
+    Interrupt_enableInterrupt(INT_EUSCIA0);
+    if (txHead != txTail) {
+        UART_enableInterrupt(uart_p->moduleInstance, EUSCI_A_UART_TRANSMIT_INTERRUPT);
+    }
+}
+
+// Sends the next queued character each time TXBUF empties
+void EUSCIA0_IRQHandler() {
+    uint32_t status = UART_getEnabledInterruptStatus(USB_UART_INSTANCE);
+
+    if (status & EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG) {
+        if (txHead == txTail) {
+            UART_disableInterrupt(USB_UART_INSTANCE, EUSCI_A_UART_TRANSMIT_INTERRUPT);
+        } else {
+            UART_transmitData(USB_UART_INSTANCE, txRing[txTail]);
+            txTail = (txTail + 1) & (UART_TX_RING_SIZE - 1);
+        }
+    }
 }
 
 // Check if character is available
@@ -51,34 +90,165 @@ bool UART_hasChar(UART* uart_p) {
 
 // Read a character
 char UART_getChar(UART* uart_p) {
-    return (char)UART_receiveData(uart_p->moduleInstance);
+    // Error flags belong to the byte in RXBUF and clear when it is read
+    if (UART_queryStatusFlags(uart_p->moduleInstance, EUSCI_A_UART_FRAMING_ERROR)) {
+        uart_p->rxError = true;
+    }
+
+    char c = (char)UART_receiveData(uart_p->moduleInstance);
+
+    // Terminals only send ASCII, so a high bit means a rate mismatch
+    if (c & 0x80) {
+        uart_p->rxError = true;
+    }
+
+    return c;
 }
 
-// Check if ready to send
+// Check if the ring has room; never while the UART is off for auto-baud
 bool UART_canSend(UART* uart_p) {
-    uint8_t status = UART_getInterruptStatus(uart_p->moduleInstance,
-                                             EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG);
-    return (status == EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG);
+    return UART_txFree(uart_p) > 0;
 }
 
-// Send a character
+// Free space in the transmit ring, none while the UART is off
+uint32_t UART_txFree(UART* uart_p) {
+    if (!txEnabled) {
+        return 0;
+    }
+    return (txTail - txHead - 1) & (UART_TX_RING_SIZE - 1);
+}
+
+// Wait for room in the ring; gives up at once while the UART is off, so
+// callers cannot hang during auto-baud
+bool UART_waitToSend(UART* uart_p) {
+    while (txEnabled && !UART_canSend(uart_p));
+    return txEnabled;
+}
+
+// Queue a character, dropping it if the ring is full or the UART is off
 void UART_sendChar(UART* uart_p, char c) {
-    if (UART_getInterruptStatus(uart_p->moduleInstance,
-                                EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG)) {
-        UART_transmitData(uart_p->moduleInstance, c);
+    uint32_t next = (txHead + 1) & (UART_TX_RING_SIZE - 1);
+
+    if (!txEnabled || next == txTail) {
+        return;
     }
+
+    txRing[txHead] = (uint8_t)c;
+    txHead = next;
+    UART_enableInterrupt(uart_p->moduleInstance, EUSCI_A_UART_TRANSMIT_INTERRUPT);
 }
 
-// Send a string with newline
+// Send a string with newline; nothing is sent while the UART is off
 void UART_sendString(UART* uart_p, const char* str) {
     while (*str) {
-        while (!UART_canSend(uart_p));
+        if (!UART_waitToSend(uart_p)) {
+            return;
+        }
         UART_sendChar(uart_p, *str);
         str++;
     }
-    while (!UART_canSend(uart_p));
+    if (!UART_waitToSend(uart_p)) {
+        return;
+    }
     UART_sendChar(uart_p, '\r');
 
-    while (!UART_canSend(uart_p));
+    if (!UART_waitToSend(uart_p)) {
+        return;
+    }
     UART_sendChar(uart_p, '\n');
 }
+
+// Send a signed decimal number without a newline
+void UART_sendNumber(UART* uart_p, int32_t value) {
+    char digits[FORMAT_MAX_INT_LEN];
+    Format_int(digits, value, 0, ' ');
+
+    char* c = digits;
+    while (*c) {
+        if (!UART_waitToSend(uart_p)) {
+            return;
+        }
+        UART_sendChar(uart_p, *c);
+        c++;
+    }
+}
+
+// Check for a receive error and clear it
+bool UART_hasRxError(UART* uart_p) {
+    bool error = uart_p->rxError;
+    uart_p->rxError = false;
+    return error;
+}
+
+// Times each RX edge against the free-running Timer32 counter
+void PORT1_IRQHandler() {
+    uint32_t now = Timer32_getValue(TIMER32_0_BASE);
+    uint32_t status = GPIO_getEnabledInterruptStatus(USB_UART_PORT);
+    GPIO_clearInterruptFlag(USB_UART_PORT, status);
+
+    if (status & USB_UART_RX_PIN) {
+        // Timer32 counts down, so older edges have larger values
+        if (autoBaudEdges > 0) {
+            uint32_t pulse = autoBaudLastEdge - now;
+            if (pulse < autoBaudMinPulse) {
+                autoBaudMinPulse = pulse;
+            }
+        }
+        autoBaudLastEdge = now;
+        autoBaudEdges++;
+
+        // Alternate edges so both high and low pulses are timed
+        autoBaudFallingNext = !autoBaudFallingNext;
+        GPIO_interruptEdgeSelect(USB_UART_PORT, USB_UART_RX_PIN,
+                                 autoBaudFallingNext ? GPIO_HIGH_TO_LOW_TRANSITION
+                                                     : GPIO_LOW_TO_HIGH_TRANSITION);
+    }
+}
+
+// Release the UART and watch the RX pin as a plain GPIO
+void UART_startAutoBaud(UART* uart_p) {
+    txEnabled = false;
+    UART_disableModule(uart_p->moduleInstance);
+    GPIO_setAsInputPin(USB_UART_PORT, USB_UART_RX_PIN);
+
+    autoBaudEdges = 0;
+    autoBaudMinPulse = 0xFFFFFFFF;
+    autoBaudFallingNext = true;
+
+    // The line idles high, so the first edge is a start bit
+    GPIO_interruptEdgeSelect(USB_UART_PORT, USB_UART_RX_PIN, GPIO_HIGH_TO_LOW_TRANSITION);
+    GPIO_clearInterruptFlag(USB_UART_PORT, USB_UART_RX_PIN);
+    GPIO_enableInterrupt(USB_UART_PORT, USB_UART_RX_PIN);
+    Interrupt_enableInterrupt(INT_PORT1);
+}
+
+// Pick the rate whose bit time is closest to the shortest pulse seen
+bool UART_autoBaudDone(UART* uart_p, UART_Baudrate* baudChoice) {
+    if (autoBaudEdges < AUTOBAUD_MIN_EDGES) {
+        return false;
+    }
+
+    UART_cancelAutoBaud(uart_p);
+
+    // Relative error of a rate is |pulse * rate - clock| / clock
+    uint64_t bestError = 0xFFFFFFFFFFFFFFFF;
+    int i;
+    for (i = 0; i < NUM_BAUD_CHOICES; i++) {
+        int64_t error = (int64_t)autoBaudMinPulse * baudRateMapping[i] - SYSTEM_CLOCK;
+        uint64_t absError = (uint64_t)(error < 0 ? -error : error);
+        if (absError < bestError) {
+            bestError = absError;
+            *baudChoice = (UART_Baudrate)i;
+        }
+    }
+
+    return true;
+}
+
+// Stop edge timing and hand the RX pin back to the UART
+void UART_cancelAutoBaud(UART* uart_p) {
+    GPIO_disableInterrupt(USB_UART_PORT, USB_UART_RX_PIN);
+    GPIO_setAsPeripheralModuleFunctionInputPin(uart_p->port, uart_p->pins,
+                                               GPIO_PRIMARY_MODULE_FUNCTION);
+    uart_p->rxError = false;
+}
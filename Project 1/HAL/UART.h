@@ -12,6 +12,13 @@
 #define USB_UART_PORT GPIO_PORT_P1
 #define USB_UART_PINS (GPIO_PIN2 | GPIO_PIN3)
 #define USB_UART_INSTANCE EUSCI_A0_BASE
+#define USB_UART_RX_PIN GPIO_PIN2
+
+// Bytes buffered for interrupt-driven transmit (power of two)
+#define UART_TX_RING_SIZE 512
+
+// Edges to time before auto-baud picks a rate (a few typed characters)
+#define AUTOBAUD_MIN_EDGES 12
 
 // Baud rate options
 enum _UART_Baudrate {
@@ -29,6 +36,7 @@ struct _UART {
     uint32_t moduleInstance;
     uint32_t port;
     uint32_t pins;
+    bool rxError;
 };
 typedef struct _UART UART;
 
@@ -44,10 +52,16 @@ bool UART_hasChar(UART* uart_p);
 // Read a character
 char UART_getChar(UART* uart_p);
 
-// Check if ready to send
+// Check if the transmit ring has room for another character
 bool UART_canSend(UART* uart_p);
 
-// Send a character
+// Number of characters that can be queued without waiting
+uint32_t UART_txFree(UART* uart_p);
+
+// Wait for room to queue a character; false if the UART is off for auto-baud
+bool UART_waitToSend(UART* uart_p);
+
+// Queue a character; the TX interrupt sends it in the background
 void UART_sendChar(UART* uart_p, char c);
 
 // Update baud rate
@@ -56,4 +70,19 @@ void UART_updateBaud(UART* uart_p, UART_Baudrate baudChoice);
 // Send a string
 void UART_sendString(UART* uart_p, const char* str);
 
+// Send a signed decimal number without a newline
+void UART_sendNumber(UART* uart_p, int32_t value);
+
+// Check for a framing error or non-ASCII byte since the last call
+bool UART_hasRxError(UART* uart_p);
+
+// Disable the UART and time pulses on the RX pin to find the baud rate
+void UART_startAutoBaud(UART* uart_p);
+
+// Check if auto-baud has seen enough edges and get the closest rate
+bool UART_autoBaudDone(UART* uart_p, UART_Baudrate* baudChoice);
+
+// Stop auto-baud timing and give the RX pin back to the UART
+void UART_cancelAutoBaud(UART* uart_p);
+
 #endif /* HAL_UART_H_ */
@@ -0,0 +1,72 @@
+/*
+ * InputLog.c - Timestamped keys of one maze game, for exact replays
+ */
+
+#include <InputLog.h>
+#include <HAL/Format.h>
+
+// Empty the log and note how the game was set up
+void InputLog_start(InputLog* log_p, int mazeSize, uint32_t mazeSeed,
+                    uint32_t gameSeed, int enemies, int chasePercent) {
+    log_p->mazeSize = mazeSize;
+    log_p->mazeSeed = mazeSeed;
+    log_p->gameSeed = gameSeed;
+    log_p->enemies = enemies;
+    log_p->chasePercent = chasePercent;
+    log_p->count = 0;
+    log_p->overflow = false;
+}
+
+// Append one key fed to MazeGame_step
+void InputLog_record(InputLog* log_p, uint32_t time_ms, char key) {
+    if (log_p->count >= INPUTLOG_MAX) {
+        log_p->overflow = true;
+        return;
+    }
+
+    log_p->events[log_p->count].time_ms = time_ms;
+    log_p->events[log_p->count].key = key;
+    log_p->count++;
+}
+
+int InputLog_formatHeader(char* buf, const InputLog* log_p) {
+    char* p = buf;
+    p += Format_string(p, "MAZELOG ");
+    p += Format_uint(p, log_p->mazeSize, 0, ' ');
+    p += Format_string(p, " ");
+    p += Format_uint(p, log_p->mazeSeed, 0, ' ');
+    p += Format_string(p, " ");
+    p += Format_uint(p, log_p->gameSeed, 0, ' ');
+    p += Format_string(p, " ");
+    p += Format_uint(p, log_p->enemies, 0, ' ');
+    p += Format_string(p, " ");
+    p += Format_uint(p, log_p->chasePercent, 0, ' ');
+    return p - buf;
+}
+
+int InputLog_formatEvent(char* buf, const InputEvent* event_p) {
+    char* p = buf;
+    p += Format_uint(p, event_p->time_ms, 0, ' ');
+    p += Format_string(p, " ");
+
+    // Any byte can be a key; keep the line printable
+    if (event_p->key > ' ' && event_p->key <= '~') {
+        *p++ = event_p->key;
+        *p = '\0';
+    } else {
+        p += Format_string(p, "0x");
+        p += Format_hex(p, (uint8_t)event_p->key, 2);
+    }
+    return p - buf;
+}
+
+int InputLog_formatEnd(char* buf, const MazeGame* game_p) {
+    char* p = buf;
+    p += Format_string(p, "END ");
+    p += Format_uint(p, game_p->moveCount, 0, ' ');
+    p += Format_string(p, " ");
+    p += Format_uint(p, game_p->state, 0, ' ');
+    p += Format_string(p, " ");
+    p += Format_hex(p, MazeGame_hash(game_p), 8);
+    return p - buf;
+}
@@ -0,0 +1,57 @@
+/*
+ * InputLog.h - Timestamped keys of one maze game, for exact replays
+ *
+ * The header holds what rebuilds the game (maze size and seed, game seed,
+ * enemies and difficulty); with those, the keys alone decide everything
+ * that happens (see MazeGame.h). Timestamps are milliseconds since the game
+ * started and only serve to replay at the original pace. The text form is
+ *
+ *   MAZELOG <mazeSize> <mazeSeed> <gameSeed> <enemies> <chasePercent>
+ *   <ms> <key>                      one line per key
+ *   END <moves> <state> <hash>      hash is MazeGame_hash in hex
+ *
+ * where a mazeSize of 0 means a level from the pack (LevelPack.h) and the
+ * mazeSeed is its index.
+ */
+
+#ifndef INPUTLOG_H_
+#define INPUTLOG_H_
+
+#include <MazeGame.h>
+
+// Keys kept per game; later keys are dropped and the log marked incomplete
+#define INPUTLOG_MAX 256
+
+// Longest text line any InputLog_format* call writes, terminator included
+#define INPUTLOG_LINE_MAX 64
+
+typedef struct {
+    uint32_t time_ms;
+    char key;
+} InputEvent;
+
+typedef struct {
+    uint8_t mazeSize;
+    uint32_t mazeSeed;
+    uint32_t gameSeed;
+    uint8_t enemies;
+    uint8_t chasePercent;
+
+    int count;
+    bool overflow;
+    InputEvent events[INPUTLOG_MAX];
+} InputLog;
+
+// Empty the log and note how the game was set up
+void InputLog_start(InputLog* log_p, int mazeSize, uint32_t mazeSeed,
+                    uint32_t gameSeed, int enemies, int chasePercent);
+
+// Append one key fed to MazeGame_step
+void InputLog_record(InputLog* log_p, uint32_t time_ms, char key);
+
+// Text lines of the log; each returns the length written to buf
+int InputLog_formatHeader(char* buf, const InputLog* log_p);
+int InputLog_formatEvent(char* buf, const InputEvent* event_p);
+int InputLog_formatEnd(char* buf, const MazeGame* game_p);
+
+#endif /* INPUTLOG_H_ */
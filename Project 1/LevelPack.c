@@ -0,0 +1,103 @@
+/*
+ * LevelPack.c - Maze levels compiled into flash
+ */
+
+#include <LevelPack.h>
+#include <string.h>
+
+// Set count walls starting at cell (*x_p, *y_p), moving the position past them
+static void setWalls(MazeStorage* storage_p, int* x_p, int* y_p, int count) {
+    const Maze* maze_p = &storage_p->maze;
+    int x = *x_p;
+    int y = *y_p;
+
+    while (count > 0) {
+        storage_p->walls[y * maze_p->rowWords + (x >> 5)] |= 1u << (x & 31);
+        count--;
+        if (++x == maze_p->width) {
+            x = 0;
+            y++;
+        }
+    }
+
+    *x_p = x;
+    *y_p = y;
+}
+
+// Move the position past count open cells
+static void skipCells(const Maze* maze_p, int* x_p, int* y_p, int count) {
+    int cell = *x_p + count;
+
+    // Runs are seldom longer than a few rows, so subtracting beats dividing
+    while (cell >= maze_p->width) {
+        cell -= maze_p->width;
+        (*y_p)++;
+    }
+    *x_p = cell;
+}
+
+// Decode one level straight into storage_p's walls
+const Maze* LevelPack_load(MazeStorage* storage_p, int index,
+                           EnemySpawn* spawns_p, int* spawnCount_p) {
+    const uint8_t* p = Levels_data + Levels_offsets[index];
+    Maze* maze_p = &storage_p->maze;
+    int i;
+
+    maze_p->width = *p++;
+    maze_p->height = *p++;
+    maze_p->rowWords = MAZE_ROW_WORDS(maze_p->width);
+    maze_p->startX = *p++;
+    maze_p->startY = *p++;
+    maze_p->goalX = *p++;
+    maze_p->goalY = *p++;
+    maze_p->walls = storage_p->walls;
+
+    uint8_t flags = *p++;
+    int spawnCount = *p++;
+    for (i = 0; i < spawnCount; i++) {
+        spawns_p[i].x = p[0];
+        spawns_p[i].y = p[1];
+        spawns_p[i].behavior = p[2] & 0x0F;
+        spawns_p[i].speed = p[2] >> 4;
+        p += 3;
+    }
+    *spawnCount_p = spawnCount;
+
+    memset(storage_p->walls, 0, maze_p->height * maze_p->rowWords * sizeof(uint32_t));
+
+    int cells = maze_p->width * maze_p->height;
+    int x = 0, y = 0;
+
+    if (flags & LEVELPACK_RUNS) {
+        bool wall = true;
+        int cell = 0;
+
+        while (cell < cells) {
+            int run = *p++;
+            if (run & 0x80) {
+                run = ((run & 0x7F) << 8) | *p++;
+            }
+
+            if (wall) {
+                setWalls(storage_p, &x, &y, run);
+            } else {
+                skipCells(maze_p, &x, &y, run);
+            }
+            cell += run;
+            wall = !wall;
+        }
+    } else {
+        int cell;
+        for (cell = 0; cell < cells; cell++) {
+            if ((p[cell >> 3] >> (cell & 7)) & 1) {
+                storage_p->walls[y * maze_p->rowWords + (x >> 5)] |= 1u << (x & 31);
+            }
+            if (++x == maze_p->width) {
+                x = 0;
+                y++;
+            }
+        }
+    }
+
+    return maze_p;
+}
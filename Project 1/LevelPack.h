@@ -0,0 +1,40 @@
+/*
+ * LevelPack.h - Maze levels compiled into flash
+ *
+ * tools/levelc.c turns the text maps in levels/levels.txt into Levels.c:
+ * one byte stream holding every level, and the offset of each level in it.
+ * A level is
+ *
+ *   width height startX startY goalX goalY
+ *   flags                   LEVELPACK_RUNS if the walls are run-length coded
+ *   spawnCount              then x, y, behavior | speed << 4 for each enemy
+ *   walls                   row by row
+ *
+ * Bit-packed walls hold one bit per cell, LSB first, with no padding between
+ * rows. Run-length walls alternate wall and open runs, starting with walls
+ * (the first run may be 0); a run under 128 is one byte and longer ones are
+ * two, 0x80 | high bits then the low byte. The compiler keeps whichever form
+ * is shorter for each level.
+ */
+
+#ifndef LEVELPACK_H_
+#define LEVELPACK_H_
+
+#include <MazeGame.h>
+#include <MazeGen.h>
+
+// Level flag: walls are run-length coded instead of bit-packed
+#define LEVELPACK_RUNS 0x01
+
+// The pack itself, from the generated Levels.c
+extern const int Levels_count;
+extern const uint16_t Levels_offsets[];
+extern const uint8_t Levels_data[];
+
+// Decode level index (0 .. Levels_count - 1) straight into storage_p's wall
+// bitboard and return its maze. The enemies it places go to spawns_p, which
+// must hold MAZEGAME_MAX_SPAWNS, and their number to *spawnCount_p.
+const Maze* LevelPack_load(MazeStorage* storage_p, int index,
+                           EnemySpawn* spawns_p, int* spawnCount_p);
+
+#endif /* LEVELPACK_H_ */
@@ -0,0 +1,280 @@
+/*
+ * Levels.c - Level pack compiled from levels/levels.txt
+ *
+ * Generated by tools/levelc.c; edit the text maps and regenerate instead
+ * of changing this file. The format is described in LevelPack.h.
+ */
+
+#include <LevelPack.h>
+
+const int Levels_count = 25;
+
+const uint16_t Levels_offsets[25] = {
+    0, 24, 54, 86, 128, 173, 229, 289, 357, 429, 515, 606,
+    712, 823, 945, 1081, 1226, 1386, 1556, 1743, 1951, 2167, 2405, 2664,
+    2947
+};
+
+const uint8_t Levels_data[3129] = {
+    0x0A, 0x0A, 0x01, 0x09, 0x09, 0x01, 0x00, 0x01, 0x07, 0x01, 0x11, 0xFF,
+    0x07, 0xD0, 0x61, 0xA0, 0x81, 0x66, 0x18, 0x67, 0xA0, 0x0D, 0xF6, 0x0F,
+    0x0B, 0x0B, 0x01, 0x0A, 0x0A, 0x01, 0x00, 0x02, 0x09, 0x02, 0x11, 0x07,
+    0x07, 0x10, 0xFF, 0x2F, 0x40, 0x7D, 0x03, 0xDA, 0xDF, 0x02, 0xDE, 0x37,
+    0xA2, 0x5D, 0x2D, 0x62, 0xFF, 0x01, 0x0D, 0x0B, 0x01, 0x0A, 0x0C, 0x01,
+    0x00, 0x02, 0x08, 0x01, 0x11, 0x08, 0x09, 0x10, 0xFF, 0x3F, 0x02, 0xD4,
+    0xDD, 0xA2, 0xD8, 0xD5, 0x23, 0x62, 0xFD, 0xAD, 0xA0, 0xD7, 0x37, 0x02,
+    0xF6, 0x7F, 0x0F, 0x0D, 0x01, 0x0C, 0x0E, 0x01, 0x00, 0x03, 0x09, 0x01,
+    0x11, 0x0B, 0x01, 0x10, 0x05, 0x05, 0x10, 0xFF, 0xFF, 0x00, 0x40, 0xD7,
+    0xB7, 0xA0, 0x58, 0x5F, 0xAF, 0xA0, 0x56, 0x55, 0xAB, 0x8A, 0x57, 0xDF,
+    0x28, 0x60, 0xF7, 0xBF, 0x00, 0xD8, 0xFF, 0x07, 0x11, 0x0D, 0x01, 0x0C,
+    0x10, 0x01, 0x00, 0x03, 0x0E, 0x03, 0x10, 0x0B, 0x05, 0x11, 0x0D, 0x0B,
+    0x10, 0xFF, 0xFF, 0x0B, 0x82, 0x54, 0x75, 0x8D, 0xA2, 0xD8, 0x7D, 0xB7,
+    0x08, 0x68, 0x5D, 0xDF, 0x8A, 0xA0, 0x55, 0x15, 0xAB, 0xA2, 0x5E, 0x5D,
+    0x8D, 0x82, 0xD8, 0xFF, 0x1F, 0x13, 0x0F, 0x01, 0x0E, 0x12, 0x01, 0x00,
+    0x04, 0x01, 0x05, 0x11, 0x09, 0x09, 0x10, 0x0D, 0x0A, 0x10, 0x11, 0x0C,
+    0x11, 0xFF, 0xFF, 0x8F, 0x00, 0x40, 0xF5, 0x7D, 0x2B, 0x88, 0x78, 0x5F,
+    0xF7, 0x88, 0x22, 0x76, 0x55, 0x37, 0x8A, 0xA2, 0xD5, 0x5F, 0x2D, 0x00,
+    0xEA, 0xFF, 0x77, 0x03, 0x00, 0xD8, 0x5F, 0xD5, 0x02, 0x80, 0xF6, 0xFF,
+    0x1F, 0x15, 0x0F, 0x01, 0x0E, 0x14, 0x01, 0x00, 0x04, 0x07, 0x03, 0x11,
+    0x10, 0x09, 0x11, 0x11, 0x09, 0x10, 0x09, 0x0A, 0x10, 0xFF, 0xFF, 0xBF,
+    0x00, 0x08, 0xD4, 0x5F, 0xDD, 0x00, 0x28, 0xDA, 0xF7, 0x55, 0x8B, 0x22,
+    0x6A, 0xD5, 0x1D, 0xAD, 0x0A, 0x8A, 0x57, 0x1D, 0x35, 0x2A, 0x8A, 0x76,
+    0xD5, 0xDD, 0x88, 0x02, 0x7A, 0xDF, 0x7D, 0x23, 0x20, 0x60, 0xFF, 0xFF,
+    0x07, 0x15, 0x11, 0x01, 0x10, 0x14, 0x01, 0x00, 0x05, 0x0F, 0x01, 0x10,
+    0x05, 0x03, 0x11, 0x08, 0x03, 0x10, 0x11, 0x08, 0x20, 0x11, 0x0C, 0x11,
+    0xFF, 0xFF, 0x3F, 0x00, 0x08, 0xD4, 0x7F, 0xDD, 0x22, 0x22, 0xD8, 0x15,
+    0x77, 0x03, 0x2A, 0xE2, 0xDF, 0x75, 0x0D, 0x22, 0xA8, 0x5D, 0xD1, 0x35,
+    0xA2, 0x08, 0x5E, 0x57, 0xDD, 0x88, 0xA2, 0xD8, 0xDD, 0xD6, 0xA3, 0x08,
+    0xE2, 0xD5, 0xFD, 0x8D, 0x80, 0x80, 0xFD, 0xFF, 0x1F, 0x17, 0x11, 0x01,
+    0x10, 0x16, 0x01, 0x00, 0x05, 0x01, 0x03, 0x10, 0x13, 0x05, 0x20, 0x13,
+    0x06, 0x11, 0x0A, 0x07, 0x11, 0x0E, 0x0A, 0x10, 0xFF, 0xFF, 0xFF, 0x20,
+    0x00, 0x40, 0xDB, 0xFD, 0xB5, 0x80, 0x82, 0x58, 0x7F, 0xD5, 0x0D, 0x82,
+    0x2A, 0xB6, 0x7D, 0xD5, 0x0B, 0x02, 0x8A, 0xF5, 0xD5, 0xDD, 0x0A, 0xA0,
+    0x68, 0x55, 0x47, 0x37, 0x8A, 0xA8, 0x78, 0x6D, 0x17, 0x8D, 0x22, 0xA0,
+    0x76, 0x57, 0x57, 0x0B, 0x20, 0x80, 0xFD, 0xFF, 0x7F, 0x19, 0x13, 0x01,
+    0x12, 0x18, 0x01, 0x00, 0x06, 0x0C, 0x05, 0x10, 0x17, 0x06, 0x20, 0x15,
+    0x07, 0x10, 0x04, 0x09, 0x10, 0x17, 0x0B, 0x11, 0x15, 0x11, 0x11, 0xFF,
+    0xFF, 0xFF, 0x23, 0x00, 0x00, 0x54, 0x5D, 0xF7, 0x2D, 0x80, 0x20, 0xDA,
+    0x7F, 0x5F, 0xBD, 0x88, 0x80, 0x62, 0xC5, 0x7D, 0xDD, 0x20, 0x00, 0x8A,
+    0xDD, 0xAF, 0x57, 0x8B, 0x08, 0x20, 0x56, 0xD5, 0x6D, 0x2D, 0xA8, 0x00,
+    0x7A, 0x5B, 0xFD, 0x35, 0x20, 0xA2, 0x60, 0xD7, 0x56, 0xFD, 0xA8, 0xA8,
+    0x80, 0x57, 0x75, 0x5D, 0x23, 0x08, 0x82, 0xF6, 0xFF, 0xFF, 0x07, 0x1B,
+    0x13, 0x01, 0x12, 0x1A, 0x01, 0x00, 0x06, 0x0C, 0x01, 0x20, 0x11, 0x01,
+    0x10, 0x17, 0x03, 0x11, 0x19, 0x03, 0x10, 0x17, 0x0E, 0x11, 0x0D, 0x0F,
+    0x10, 0xFF, 0xFF, 0xFF, 0x8F, 0x08, 0x00, 0x42, 0xD5, 0xF7, 0x75, 0x0B,
+    0x02, 0x28, 0xD8, 0x57, 0x57, 0xED, 0x20, 0x80, 0x20, 0x7E, 0xFF, 0x55,
+    0x35, 0x08, 0x20, 0xA2, 0xF5, 0xF7, 0xD7, 0xAD, 0xA0, 0x88, 0x60, 0x77,
+    0x55, 0x7F, 0x0B, 0x2A, 0x22, 0x5A, 0x57, 0x75, 0xC5, 0x20, 0x20, 0xA2,
+    0xF6, 0x5D, 0xD7, 0x35, 0x22, 0x22, 0xA2, 0xD5, 0x75, 0xD5, 0x2D, 0x22,
+    0x20, 0x60, 0xFF, 0xFF, 0xFF, 0x01, 0x1D, 0x15, 0x01, 0x14, 0x1C, 0x01,
+    0x00, 0x07, 0x19, 0x01, 0x10, 0x1B, 0x03, 0x11, 0x09, 0x07, 0x10, 0x1B,
+    0x09, 0x11, 0x14, 0x0D, 0x20, 0x12, 0x11, 0x10, 0x11, 0x12, 0x11, 0xFF,
+    0xFF, 0xFF, 0xBF, 0x00, 0x08, 0x80, 0xD4, 0x57, 0xF7, 0xD5, 0x00, 0x80,
+    0x88, 0xD8, 0x6B, 0x77, 0x75, 0x23, 0xA0, 0x00, 0xE8, 0xF1, 0x77, 0x75,
+    0x8D, 0x80, 0x22, 0xA2, 0x5D, 0x45, 0x77, 0xBD, 0x20, 0x22, 0x20, 0xDE,
+    0x55, 0x77, 0xD5, 0x88, 0x02, 0xA0, 0xD8, 0x5D, 0xFF, 0x47, 0x8B, 0x08,
+    0x80, 0x62, 0xD7, 0xD7, 0xD5, 0x0D, 0x00, 0x80, 0x80, 0xD5, 0x7D, 0x7F,
+    0xB7, 0x02, 0x20, 0x80, 0x5E, 0xDF, 0x57, 0xD5, 0x08, 0x08, 0x02, 0xD8,
+    0xFF, 0xFF, 0xFF, 0x01, 0x1F, 0x15, 0x01, 0x14, 0x1E, 0x01, 0x00, 0x07,
+    0x13, 0x01, 0x11, 0x0D, 0x05, 0x11, 0x07, 0x06, 0x11, 0x07, 0x08, 0x10,
+    0x01, 0x09, 0x20, 0x1D, 0x0A, 0x10, 0x13, 0x12, 0x10, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x02, 0x80, 0x00, 0x40, 0x75, 0x5D, 0xD5, 0x3D, 0x02, 0x0A, 0x00,
+    0xD8, 0xFD, 0x5D, 0xDD, 0x8D, 0x08, 0x00, 0x22, 0xDE, 0x5D, 0xF5, 0x5D,
+    0xAB, 0x80, 0x80, 0x88, 0x55, 0x5F, 0xFD, 0xD5, 0x08, 0xA0, 0x80, 0x62,
+    0xD7, 0x55, 0x5F, 0x34, 0x0A, 0x08, 0xA2, 0x78, 0xD5, 0xF5, 0x45, 0x2D,
+    0x02, 0x08, 0x8A, 0x56, 0xDC, 0xF1, 0x71, 0x83, 0x8A, 0x82, 0x82, 0x77,
+    0x5D, 0xDF, 0xDF, 0x00, 0x08, 0x08, 0x60, 0x5D, 0xFD, 0xB5, 0xB5, 0x80,
+    0x00, 0x80, 0xD8, 0xFF, 0xFF, 0xFF, 0x07, 0x1F, 0x17, 0x01, 0x16, 0x1E,
+    0x01, 0x00, 0x08, 0x08, 0x05, 0x11, 0x01, 0x06, 0x20, 0x02, 0x0D, 0x10,
+    0x05, 0x0D, 0x11, 0x0B, 0x0E, 0x10, 0x1D, 0x0F, 0x10, 0x15, 0x11, 0x11,
+    0x13, 0x13, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0x80, 0x42, 0x6F,
+    0x5F, 0x5F, 0x35, 0x22, 0xAA, 0x20, 0x58, 0x75, 0x14, 0xDD, 0x8D, 0xA2,
+    0xA0, 0x80, 0x76, 0xD5, 0xDD, 0x55, 0x8B, 0x0A, 0x00, 0x82, 0x71, 0x57,
+    0x55, 0xDD, 0x8A, 0x80, 0x8A, 0x68, 0x17, 0x77, 0x55, 0x35, 0xA8, 0x08,
+    0x00, 0xDA, 0x5D, 0x55, 0xB7, 0x0D, 0xA2, 0x02, 0x82, 0x56, 0x1C, 0x5D,
+    0x57, 0xA3, 0xA0, 0x20, 0xA8, 0xD7, 0x57, 0xD7, 0xD6, 0x08, 0x2A, 0x0A,
+    0x60, 0x6F, 0x47, 0x75, 0x35, 0x82, 0x88, 0x0A, 0x78, 0x75, 0x1F, 0xB5,
+    0x8D, 0x80, 0x20, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x01, 0x21, 0x19, 0x01,
+    0x18, 0x20, 0x01, 0x00, 0x08, 0x11, 0x04, 0x10, 0x0A, 0x07, 0x11, 0x1F,
+    0x08, 0x20, 0x0A, 0x0B, 0x11, 0x13, 0x0C, 0x10, 0x0B, 0x13, 0x10, 0x16,
+    0x13, 0x10, 0x19, 0x15, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x02, 0x00,
+    0x00, 0xD4, 0x51, 0xF5, 0xD7, 0x2D, 0x0A, 0x08, 0x80, 0xF8, 0xF5, 0x57,
+    0x5F, 0x3F, 0x08, 0x88, 0x0A, 0x60, 0xDF, 0x56, 0x55, 0xDD, 0x02, 0x88,
+    0x0A, 0xA2, 0xFD, 0x7D, 0xD5, 0x55, 0x03, 0x08, 0x8A, 0x00, 0x76, 0xD5,
+    0x7F, 0x5D, 0x8D, 0x0A, 0x02, 0xA0, 0x5A, 0xD5, 0x51, 0x1D, 0x35, 0x0A,
+    0xAA, 0x80, 0x62, 0xF7, 0x55, 0xD5, 0xD1, 0x88, 0x88, 0x22, 0xA8, 0x77,
+    0xD5, 0xDD, 0xD7, 0x0B, 0x00, 0x82, 0x20, 0x56, 0x75, 0x7F, 0xED, 0x8D,
+    0x0A, 0x80, 0x08, 0x78, 0x51, 0x75, 0xDB, 0x37, 0x08, 0xAA, 0x20, 0x62,
+    0xD7, 0x57, 0x5F, 0xF5, 0x02, 0x00, 0x00, 0x88, 0xFD, 0xFF, 0xFF, 0xFF,
+    0x01, 0x23, 0x19, 0x01, 0x18, 0x22, 0x01, 0x00, 0x09, 0x21, 0x01, 0x11,
+    0x18, 0x03, 0x20, 0x09, 0x06, 0x10, 0x17, 0x0B, 0x11, 0x21, 0x0D, 0x11,
+    0x1B, 0x0E, 0x10, 0x07, 0x0F, 0x10, 0x18, 0x0F, 0x10, 0x19, 0x0F, 0x10,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x20, 0x20, 0x40, 0xF7, 0x76, 0x5F,
+    0xD5, 0x83, 0xA0, 0x02, 0x80, 0x58, 0xD5, 0xF5, 0xDF, 0xDD, 0x88, 0x20,
+    0x88, 0x00, 0xD6, 0x56, 0x5D, 0x75, 0xB5, 0x82, 0x28, 0x2A, 0xA0, 0xDD,
+    0x1D, 0x55, 0x75, 0x8D, 0x20, 0x0A, 0xAA, 0x68, 0x5D, 0xD5, 0x5E, 0x55,
+    0x0B, 0x20, 0x82, 0x22, 0xD8, 0x7F, 0xD5, 0xD5, 0xF5, 0x88, 0x88, 0xA8,
+    0x82, 0x16, 0x6D, 0x5D, 0xC5, 0x37, 0x0A, 0x88, 0x88, 0x82, 0xDB, 0x6F,
+    0xD5, 0x57, 0x0D, 0x02, 0x88, 0x80, 0x68, 0x7F, 0xFD, 0xFF, 0x16, 0x23,
+    0x08, 0x08, 0x00, 0x5A, 0x57, 0xDD, 0xD7, 0xD5, 0x8A, 0x02, 0x22, 0x82,
+    0x5E, 0x5D, 0x55, 0x57, 0x37, 0x02, 0x02, 0x82, 0x80, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x07, 0x25, 0x1B, 0x01, 0x1A, 0x24, 0x01, 0x00, 0x09, 0x09, 0x02,
+    0x10, 0x0A, 0x02, 0x10, 0x03, 0x03, 0x11, 0x0D, 0x05, 0x11, 0x0D, 0x0A,
+    0x11, 0x09, 0x0F, 0x10, 0x04, 0x13, 0x20, 0x12, 0x15, 0x10, 0x23, 0x15,
+    0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0x08, 0x00, 0x20, 0x74, 0x45,
+    0x5D, 0x55, 0xD5, 0xA8, 0x82, 0x00, 0xAA, 0xDA, 0x11, 0x5D, 0x77, 0x75,
+    0x83, 0x0A, 0x88, 0x80, 0x60, 0x5D, 0xDC, 0x75, 0x7D, 0x2D, 0x22, 0x80,
+    0x80, 0xA8, 0x55, 0x5F, 0x5D, 0x5D, 0x31, 0x20, 0x22, 0x08, 0xA8, 0xF6,
+    0x55, 0x57, 0x54, 0xD5, 0xA0, 0x88, 0x20, 0xA2, 0xD8, 0x55, 0x75, 0xDD,
+    0xD1, 0xAB, 0x08, 0x20, 0x8A, 0x68, 0xF5, 0xDD, 0x57, 0x5D, 0xAD, 0x08,
+    0x02, 0x82, 0xA8, 0x75, 0xD5, 0x7F, 0xD7, 0x35, 0x22, 0x02, 0xA2, 0xA2,
+    0x76, 0x55, 0x55, 0x55, 0xC5, 0x22, 0x2A, 0x2A, 0xA8, 0x1A, 0x5F, 0x7D,
+    0xED, 0x51, 0x0B, 0x22, 0xA0, 0x80, 0xE2, 0x57, 0x55, 0xD5, 0xDF, 0x0D,
+    0x80, 0x00, 0x08, 0xA0, 0xDD, 0x47, 0x55, 0xFC, 0xB5, 0x00, 0x82, 0x20,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x7F, 0x27, 0x1B, 0x01, 0x1A, 0x26, 0x01,
+    0x00, 0x0A, 0x0F, 0x01, 0x11, 0x07, 0x02, 0x10, 0x21, 0x06, 0x10, 0x0E,
+    0x07, 0x10, 0x0C, 0x09, 0x11, 0x23, 0x0A, 0x10, 0x05, 0x0F, 0x10, 0x07,
+    0x10, 0x11, 0x13, 0x10, 0x20, 0x11, 0x11, 0x11, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x20, 0x02, 0x00, 0x00, 0x40, 0x57, 0x7D, 0xDD, 0xD6, 0x35, 0x02,
+    0xA2, 0x28, 0x28, 0xDA, 0x7D, 0x55, 0x55, 0x57, 0x2D, 0x20, 0xA0, 0x80,
+    0x28, 0xD6, 0xF7, 0x55, 0x75, 0x55, 0x0B, 0x02, 0xA2, 0x82, 0x80, 0x7F,
+    0x77, 0x57, 0x7D, 0xFF, 0x80, 0x00, 0xAA, 0x02, 0x62, 0x7F, 0x7D, 0x75,
+    0x7F, 0xB5, 0x28, 0xA2, 0x02, 0x20, 0x5A, 0x51, 0x55, 0x55, 0x57, 0x8D,
+    0xA2, 0xA2, 0x28, 0x22, 0x76, 0x57, 0x15, 0x5D, 0x57, 0x23, 0x0A, 0x22,
+    0x20, 0xA2, 0x57, 0x5F, 0xF7, 0x77, 0xDD, 0x80, 0x00, 0x20, 0x20, 0x60,
+    0x5D, 0x7F, 0xC7, 0xD5, 0xB5, 0x20, 0x00, 0x8A, 0x08, 0x58, 0x5F, 0x7D,
+    0xD7, 0xD5, 0x2D, 0x20, 0x20, 0x8A, 0x02, 0x46, 0x5F, 0x77, 0x11, 0x55,
+    0x2B, 0x08, 0x00, 0x2A, 0xA2, 0xF5, 0x75, 0xF5, 0xD5, 0xDB, 0x08, 0x80,
+    0x00, 0x02, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x29, 0x1D, 0x01, 0x1C,
+    0x28, 0x01, 0x00, 0x0A, 0x0A, 0x01, 0x10, 0x07, 0x08, 0x10, 0x0F, 0x09,
+    0x20, 0x12, 0x09, 0x10, 0x02, 0x0B, 0x10, 0x05, 0x0D, 0x11, 0x19, 0x0D,
+    0x11, 0x1D, 0x13, 0x11, 0x13, 0x17, 0x10, 0x07, 0x19, 0x11, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x03, 0x02, 0x88, 0x00, 0x08, 0xF4, 0xD6, 0x56, 0xDD,
+    0x75, 0x0D, 0xA0, 0x88, 0x20, 0x0A, 0xDA, 0x7E, 0x5C, 0x75, 0x75, 0x35,
+    0x28, 0x8A, 0x80, 0x88, 0x62, 0x17, 0xD5, 0x5D, 0x55, 0xD5, 0xA0, 0x82,
+    0x88, 0x80, 0xA2, 0x75, 0xD0, 0x47, 0x7D, 0x7F, 0x23, 0x2A, 0xA0, 0x28,
+    0x00, 0x5E, 0x57, 0x75, 0x55, 0xF5, 0x0F, 0x22, 0x22, 0x2A, 0x02, 0xD8,
+    0xD7, 0x76, 0x57, 0xAD, 0xB7, 0x02, 0x28, 0x20, 0x02, 0x68, 0x75, 0x57,
+    0x7F, 0xBD, 0xD6, 0x08, 0x88, 0x08, 0x22, 0x80, 0x57, 0xC7, 0xDD, 0x55,
+    0x7B, 0x03, 0x20, 0x02, 0x8A, 0x80, 0xF6, 0xEF, 0xD5, 0xC5, 0x5F, 0x0C,
+    0x00, 0xAA, 0x20, 0x88, 0x5A, 0xBD, 0x15, 0x7D, 0x57, 0x37, 0x0A, 0xAA,
+    0x20, 0x22, 0x62, 0x75, 0xC5, 0x5D, 0xF7, 0xF5, 0x28, 0xAA, 0x28, 0x00,
+    0x80, 0x15, 0x57, 0xDD, 0x7F, 0x5D, 0xA3, 0x28, 0x22, 0x02, 0x00, 0x76,
+    0xC5, 0x56, 0x55, 0xDF, 0x2F, 0x20, 0x00, 0x20, 0x00, 0xD8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x1F, 0x2B, 0x1F, 0x01, 0x1E, 0x2A, 0x01, 0x00, 0x0B, 0x11,
+    0x02, 0x11, 0x1D, 0x02, 0x20, 0x08, 0x09, 0x11, 0x09, 0x0A, 0x10, 0x18,
+    0x0B, 0x10, 0x0C, 0x0C, 0x11, 0x19, 0x11, 0x11, 0x0D, 0x13, 0x10, 0x27,
+    0x19, 0x10, 0x0C, 0x1D, 0x10, 0x19, 0x1D, 0x10, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x20, 0x20, 0x02, 0x02, 0xC0, 0x75, 0x75, 0x5D, 0x55, 0x77,
+    0x83, 0x20, 0x20, 0x22, 0x28, 0x58, 0xD7, 0x5D, 0x45, 0x55, 0xDF, 0x02,
+    0x80, 0x82, 0xA0, 0x80, 0x76, 0x5F, 0x75, 0x55, 0x55, 0x37, 0x82, 0x28,
+    0x82, 0x2A, 0x82, 0x75, 0x75, 0x77, 0x5F, 0xD7, 0xAF, 0x20, 0x22, 0x00,
+    0x08, 0x60, 0x55, 0x77, 0x5B, 0xD7, 0x5D, 0x8B, 0x0A, 0x80, 0x88, 0x08,
+    0xDA, 0xC7, 0xDE, 0xD5, 0x1F, 0xD7, 0xA0, 0x80, 0xA8, 0x08, 0x0A, 0x76,
+    0xFD, 0x7D, 0x5D, 0x5F, 0x37, 0x0A, 0x22, 0x80, 0x20, 0x88, 0x1D, 0x57,
+    0xD5, 0x75, 0x15, 0x8F, 0x8A, 0x22, 0x02, 0x00, 0xEA, 0x15, 0x75, 0xD5,
+    0x6D, 0x55, 0x23, 0x22, 0x20, 0x22, 0xAA, 0xD8, 0x7D, 0x57, 0xDF, 0xD5,
+    0xD5, 0x22, 0x22, 0x00, 0xA0, 0x02, 0xD6, 0x75, 0x7F, 0xDD, 0xD5, 0x37,
+    0x20, 0x20, 0x00, 0xA2, 0x88, 0x5D, 0x75, 0xDD, 0xDE, 0xD5, 0x2D, 0xA2,
+    0xA8, 0x20, 0xAA, 0x68, 0x5D, 0x75, 0x7C, 0x55, 0x5D, 0x23, 0x2A, 0x0A,
+    0x22, 0x0A, 0x7A, 0x55, 0x5D, 0xB5, 0x55, 0xDD, 0x80, 0x00, 0x22, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x2D, 0x1F, 0x01, 0x1E, 0x2C,
+    0x01, 0x00, 0x0B, 0x1B, 0x01, 0x10, 0x15, 0x03, 0x10, 0x05, 0x07, 0x11,
+    0x27, 0x08, 0x10, 0x1D, 0x0E, 0x10, 0x1D, 0x13, 0x11, 0x25, 0x13, 0x10,
+    0x23, 0x16, 0x20, 0x15, 0x1B, 0x11, 0x2B, 0x1B, 0x10, 0x28, 0x1D, 0x11,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x02, 0x80, 0x20, 0x82, 0x82, 0x74,
+    0x6F, 0x55, 0x55, 0x57, 0xD5, 0x02, 0x00, 0x28, 0x88, 0x02, 0x58, 0x5F,
+    0xF7, 0x6D, 0xC5, 0x57, 0x03, 0x8A, 0x20, 0x00, 0x02, 0x62, 0x55, 0x47,
+    0xD1, 0xDB, 0x7B, 0x0F, 0x80, 0x82, 0x02, 0x02, 0xA2, 0xB7, 0x55, 0x57,
+    0x5F, 0x57, 0x35, 0x80, 0x80, 0x8A, 0x22, 0x22, 0x76, 0xD7, 0x55, 0x57,
+    0xF7, 0xF1, 0x88, 0x80, 0x88, 0x00, 0x80, 0x58, 0xB7, 0x55, 0xD7, 0x77,
+    0x45, 0x23, 0x82, 0x88, 0x82, 0xA0, 0x6A, 0xF7, 0x76, 0xD5, 0xF5, 0x57,
+    0x2D, 0x02, 0x2A, 0x20, 0x82, 0x88, 0x75, 0x7F, 0xF5, 0x5D, 0xD7, 0xBD,
+    0x20, 0xA2, 0x22, 0x02, 0x22, 0x56, 0x71, 0xD5, 0x1D, 0x75, 0xD5, 0x80,
+    0x20, 0x02, 0xAA, 0x20, 0xD8, 0xD5, 0x5D, 0x7F, 0xD5, 0x7F, 0xA3, 0x00,
+    0x0A, 0x22, 0x20, 0xE0, 0xD5, 0x5F, 0x5D, 0xAF, 0xB1, 0x2D, 0x20, 0x08,
+    0x00, 0xA0, 0x82, 0xBD, 0x5D, 0xDF, 0x76, 0x45, 0x37, 0x00, 0x88, 0x80,
+    0x02, 0x0A, 0xDE, 0x7F, 0x55, 0x5D, 0x55, 0xED, 0x08, 0x22, 0x22, 0x80,
+    0xA0, 0x58, 0x5D, 0x57, 0xB5, 0x55, 0x57, 0x8B, 0x00, 0x22, 0x80, 0x20,
+    0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x2F, 0x21, 0x01, 0x20, 0x2E,
+    0x01, 0x00, 0x0C, 0x13, 0x01, 0x11, 0x1D, 0x06, 0x10, 0x21, 0x06, 0x10,
+    0x27, 0x07, 0x11, 0x10, 0x09, 0x10, 0x09, 0x10, 0x10, 0x17, 0x11, 0x20,
+    0x1F, 0x15, 0x11, 0x0D, 0x1B, 0x11, 0x13, 0x1B, 0x10, 0x2D, 0x1C, 0x10,
+    0x29, 0x1E, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x08, 0x40, 0xD5, 0xED, 0x56, 0x5F, 0xD5, 0xB7, 0x00, 0x00, 0xA2,
+    0x08, 0x02, 0x5A, 0x55, 0x7F, 0x15, 0x75, 0xD5, 0x2D, 0x28, 0x00, 0xAA,
+    0x22, 0x0A, 0x76, 0xD5, 0x57, 0x47, 0xF5, 0xFD, 0x8B, 0x28, 0x20, 0x08,
+    0x80, 0x88, 0xD5, 0xF5, 0xD7, 0xF6, 0xDF, 0xDD, 0x2A, 0x02, 0x00, 0x22,
+    0x80, 0x62, 0xD5, 0xFB, 0x75, 0x75, 0x15, 0xBC, 0x20, 0x00, 0x88, 0x82,
+    0xA8, 0x58, 0x57, 0xFD, 0x55, 0xD7, 0x1D, 0x8D, 0x00, 0x80, 0x02, 0xA8,
+    0xA0, 0x6E, 0xF7, 0x57, 0xFB, 0xD1, 0x1B, 0x03, 0x02, 0x20, 0x08, 0x02,
+    0xA0, 0xDF, 0xED, 0x5F, 0xAD, 0xD5, 0xD5, 0x28, 0x02, 0x82, 0x02, 0x88,
+    0x68, 0x5D, 0x5F, 0x5D, 0x7D, 0x55, 0xB7, 0x20, 0xA0, 0x20, 0x22, 0x2A,
+    0x58, 0x5F, 0xD7, 0x75, 0x75, 0xD7, 0x0F, 0x88, 0x02, 0x00, 0x08, 0x22,
+    0xD6, 0x5D, 0xB5, 0xD5, 0x75, 0x55, 0x23, 0x82, 0x02, 0x8A, 0x08, 0xAA,
+    0xDD, 0x5D, 0xD5, 0xDF, 0x76, 0xD4, 0x20, 0x82, 0x02, 0x20, 0xA0, 0xE0,
+    0x5D, 0x55, 0xF5, 0xF5, 0x05, 0x35, 0x82, 0x82, 0x82, 0x00, 0x28, 0xD8,
+    0xDD, 0x55, 0x54, 0xDD, 0x57, 0x0D, 0x0A, 0x8A, 0xA2, 0x20, 0x22, 0x5E,
+    0xF5, 0x75, 0x55, 0x5F, 0x77, 0x23, 0x00, 0x00, 0x22, 0x00, 0x80, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x31, 0x23, 0x01, 0x22, 0x30, 0x01, 0x00,
+    0x0C, 0x1B, 0x03, 0x10, 0x2F, 0x09, 0x10, 0x0B, 0x0C, 0x11, 0x21, 0x0D,
+    0x10, 0x24, 0x0D, 0x10, 0x0B, 0x0E, 0x10, 0x23, 0x0F, 0x10, 0x2C, 0x0F,
+    0x11, 0x1F, 0x11, 0x10, 0x03, 0x12, 0x11, 0x0D, 0x14, 0x11, 0x2D, 0x1A,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x08, 0x00, 0x00, 0x08,
+    0x02, 0x54, 0x55, 0x57, 0x7D, 0x55, 0xF5, 0x2D, 0xA0, 0x88, 0x82, 0x80,
+    0x2A, 0x58, 0x75, 0xD5, 0x55, 0xF5, 0x55, 0x3B, 0x00, 0x22, 0xA8, 0x2A,
+    0x88, 0x60, 0xD7, 0x55, 0x1D, 0x75, 0xDF, 0xDF, 0x02, 0xA0, 0x82, 0x28,
+    0x02, 0x80, 0x55, 0x77, 0x51, 0x5D, 0x77, 0x77, 0x23, 0x20, 0x28, 0x80,
+    0x00, 0x88, 0xF6, 0x55, 0x5D, 0x77, 0x55, 0x7B, 0x2D, 0xA0, 0x88, 0x08,
+    0x20, 0x22, 0x5A, 0x77, 0xDD, 0xD7, 0x7E, 0x55, 0xB5, 0x08, 0x88, 0x08,
+    0x20, 0x28, 0x60, 0x57, 0x55, 0xF5, 0x5D, 0xDF, 0xDB, 0x22, 0x28, 0x00,
+    0xAA, 0x20, 0x80, 0xD7, 0x57, 0xDF, 0x55, 0xDD, 0xAD, 0xA3, 0x08, 0x80,
+    0x88, 0x20, 0x08, 0x56, 0x55, 0x57, 0x5C, 0xDF, 0x57, 0xAF, 0x80, 0xA2,
+    0x82, 0x80, 0xA0, 0xD8, 0xD5, 0x55, 0x57, 0x55, 0x7D, 0x37, 0x02, 0x08,
+    0xA2, 0x2A, 0x00, 0x62, 0xBD, 0x7D, 0x55, 0xDC, 0x7F, 0xD5, 0x00, 0x8A,
+    0x88, 0x22, 0x00, 0x8A, 0xDD, 0x55, 0x5F, 0x15, 0xDD, 0x51, 0x0B, 0xA2,
+    0x20, 0xA0, 0x08, 0x88, 0xD6, 0x5D, 0x5F, 0x7B, 0xD7, 0x47, 0x0D, 0x82,
+    0x00, 0x80, 0x00, 0xA2, 0xDA, 0xD7, 0xD7, 0x55, 0xDD, 0x71, 0x34, 0x20,
+    0x22, 0x08, 0x22, 0x28, 0xE2, 0x55, 0xF7, 0x45, 0xD5, 0x55, 0xD5, 0x28,
+    0x22, 0x2A, 0x20, 0x28, 0x82, 0x55, 0x77, 0x17, 0xDF, 0xD5, 0x57, 0x83,
+    0x20, 0x80, 0x80, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x33, 0x25, 0x01, 0x24, 0x32, 0x01, 0x00, 0x0D, 0x15, 0x03, 0x10, 0x27,
+    0x05, 0x10, 0x11, 0x0A, 0x11, 0x2D, 0x0D, 0x10, 0x30, 0x11, 0x10, 0x19,
+    0x14, 0x11, 0x01, 0x16, 0x11, 0x0B, 0x17, 0x10, 0x07, 0x19, 0x10, 0x21,
+    0x19, 0x11, 0x21, 0x1B, 0x20, 0x1F, 0x1D, 0x10, 0x31, 0x1D, 0x11, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x20, 0x20, 0x02, 0x80, 0x00, 0x40,
+    0x55, 0x5F, 0x57, 0x5D, 0x55, 0xED, 0x0B, 0x00, 0x02, 0xA2, 0x8A, 0x2A,
+    0xD8, 0xF7, 0x7E, 0xDD, 0xD5, 0x16, 0xD4, 0xA8, 0x80, 0x20, 0x80, 0x80,
+    0x2A, 0x16, 0xB4, 0x55, 0xD5, 0xB5, 0x57, 0xB5, 0x0A, 0x88, 0x80, 0x02,
+    0x20, 0x80, 0xC5, 0x55, 0xDD, 0xD5, 0xDF, 0x6D, 0x8D, 0x00, 0x02, 0x82,
+    0x20, 0x02, 0x68, 0x57, 0x55, 0x5D, 0x5F, 0xD5, 0x57, 0xA3, 0xA8, 0x08,
+    0x08, 0x28, 0x22, 0x78, 0x7F, 0x75, 0x7D, 0x6F, 0x5C, 0xDD, 0x00, 0x2A,
+    0x08, 0x08, 0x28, 0x02, 0x76, 0x57, 0x5F, 0x7D, 0xD7, 0x75, 0x35, 0x08,
+    0x82, 0x20, 0xA8, 0x20, 0x80, 0xDD, 0x77, 0x75, 0x5D, 0x7C, 0x75, 0x0D,
+    0x02, 0x8A, 0xA8, 0x08, 0x22, 0x60, 0x5D, 0x47, 0x7F, 0x55, 0x75, 0xDF,
+    0x23, 0x82, 0x08, 0x8A, 0xA0, 0x88, 0xD8, 0x5D, 0x55, 0x55, 0x6D, 0x75,
+    0xDF, 0xA8, 0x02, 0x20, 0x22, 0x00, 0x00, 0x56, 0x75, 0xED, 0x5B, 0xD7,
+    0x77, 0xB5, 0x20, 0x0A, 0x08, 0x20, 0x20, 0xA8, 0x75, 0x77, 0x55, 0x55,
+    0x75, 0x7F, 0x0D, 0x22, 0x20, 0x88, 0x20, 0x0A, 0x68, 0x77, 0xF5, 0x7D,
+    0x55, 0x55, 0x15, 0x83, 0x20, 0x00, 0x80, 0x88, 0x0A, 0x7A, 0xF7, 0xFF,
+    0xB5, 0xDF, 0x71, 0xDD, 0x08, 0x20, 0x00, 0x00, 0x20, 0x82, 0x76, 0x77,
+    0xDD, 0xFE, 0xB5, 0xF7, 0xB5, 0x2A, 0x20, 0x80, 0x00, 0x88, 0x80, 0x55,
+    0x5D, 0xF5, 0x55, 0x57, 0xF7, 0xAD, 0x88, 0x08, 0x22, 0x80, 0x88, 0x60,
+    0xDD, 0x75, 0x55, 0xBD, 0x7D, 0x57, 0x0B, 0x08, 0x00, 0x20, 0x00, 0x80,
+    0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x28, 0x1E, 0x01, 0x1D, 0x26,
+    0x00, 0x00, 0x08, 0x06, 0x03, 0x20, 0x14, 0x03, 0x11, 0x23, 0x08, 0x10,
+    0x0A, 0x0A, 0x11, 0x19, 0x0C, 0x11, 0x1E, 0x14, 0x10, 0x0F, 0x19, 0x10,
+    0x25, 0x1A, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x80, 0x31,
+    0x0C, 0xC3, 0x30, 0x8C, 0x31, 0x0C, 0xC3, 0x30, 0x8C, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0x80, 0x31, 0x08, 0xC3, 0x30, 0x8C, 0x31, 0x0C,
+    0xC3, 0x30, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x80, 0xDF, 0xFF, 0xFB, 0x7F, 0xFF, 0x31,
+    0x0C, 0xC3, 0x30, 0x8C, 0x31, 0x0C, 0xC3, 0x30, 0x8C, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0x80, 0x31, 0x0C, 0xC3, 0x30, 0x8C, 0x31, 0x0C,
+    0xC3, 0x30, 0x8C, 0x01, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00,
+    0x80, 0x01, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x00, 0x80, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF
+};
@@ -0,0 +1,27 @@
+/*
+ * Maze.c - Built-in maze layouts
+ */
+
+#include <Maze.h>
+
+// Bit 0 is the leftmost column
+static const uint32_t defaultWalls[10] = {
+    0x3FF,  // X X X X X X X X X X
+    0x001,  // X _ _ _ _ _ _ _ _ G
+    0x21D,  // X _ X X X _ _ _ _ X
+    0x281,  // X _ _ _ _ _ _ X _ X
+    0x281,  // X _ _ _ _ _ _ X _ X
+    0x219,  // X _ _ X X _ _ _ _ X
+    0x271,  // X _ _ _ X X X _ _ X
+    0x281,  // X _ _ _ _ _ _ X _ X
+    0x20D,  // X _ X X _ _ _ _ _ X
+    0x3FD   // X S X X X X X X X X
+};
+
+const Maze Maze_default = {
+    10, 10,
+    MAZE_ROW_WORDS(10),
+    1, 9,
+    9, 1,
+    defaultWalls
+};
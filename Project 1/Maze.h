@@ -0,0 +1,59 @@
+/*
+ * Maze.h - Maze layout shared by drawing and movement checks
+ *
+ * Walls are a bitboard: one bit per cell, rows padded to whole 32-bit words,
+ * bit x of word (y * rowWords + x / 32) set for a wall. Start and goal are
+ * kept as coordinates instead of cell types. Coordinates are in cells.
+ */
+
+#ifndef MAZE_H_
+#define MAZE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Number of 32-bit words needed for one row of a maze this wide
+#define MAZE_ROW_WORDS(width) (((width) + 31) / 32)
+
+// What a cell holds
+typedef enum {
+    MAZE_PATH,
+    MAZE_WALL,
+    MAZE_START,
+    MAZE_GOAL
+} MazeCell;
+
+// Maze layout; walls may live in flash or RAM
+typedef struct {
+    uint8_t width, height;
+    uint8_t rowWords;
+    uint8_t startX, startY;
+    uint8_t goalX, goalY;
+    const uint32_t* walls;
+} Maze;
+
+// The built-in 10x10 maze
+extern const Maze Maze_default;
+
+// Cells outside the maze count as walls
+static inline bool Maze_isWall(const Maze* maze_p, int x, int y) {
+    if ((unsigned)x >= maze_p->width || (unsigned)y >= maze_p->height) {
+        return true;
+    }
+    return (maze_p->walls[y * maze_p->rowWords + (x >> 5)] >> (x & 31)) & 1;
+}
+
+static inline MazeCell Maze_cellAt(const Maze* maze_p, int x, int y) {
+    if (Maze_isWall(maze_p, x, y)) {
+        return MAZE_WALL;
+    }
+    if (x == maze_p->goalX && y == maze_p->goalY) {
+        return MAZE_GOAL;
+    }
+    if (x == maze_p->startX && y == maze_p->startY) {
+        return MAZE_START;
+    }
+    return MAZE_PATH;
+}
+
+#endif /* MAZE_H_ */
@@ -0,0 +1,212 @@
+/*
+ * MazeGame.c - Rules of one maze game, with no hardware behind them
+ */
+
+#include <MazeGame.h>
+#include <string.h>
+
+// Extra enemies spawn at least this many steps (Manhattan) from the start
+#define ENEMY_SAFE_DISTANCE 8
+
+// Put the enemies at their starting cells. A level's own spawns are used as
+// they are. Otherwise the first guards the goal and extra ones go on random
+// open cells away from the start, mostly wanderers with every fourth a
+// hunter and every fifth a fast wanderer.
+static void placeEnemies(MazeGame* game_p) {
+    EnemySet* enemies_p = &game_p->enemies;
+    const Maze* maze_p = game_p->maze_p;
+    int i;
+
+    EnemySet_clear(enemies_p, game_p->moves_p);
+
+    if (game_p->spawnCount > 0) {
+        for (i = 0; i < game_p->spawnCount; i++) {
+            const EnemySpawn* spawn_p = &game_p->spawns[i];
+            EnemySet_add(enemies_p, spawn_p->x, spawn_p->y,
+                         (EnemyBehavior)spawn_p->behavior, spawn_p->speed);
+        }
+        return;
+    }
+    if (game_p->enemyCount == 0) {
+        return;
+    }
+
+    EnemySet_add(enemies_p, game_p->enemyStart_x, game_p->enemyStart_y, ENEMY_HUNTER, 1);
+
+    for (i = 1; i < game_p->enemyCount; i++) {
+        EnemyBehavior behavior = (i % 4 == 0) ? ENEMY_HUNTER : ENEMY_WANDERER;
+        int speed = (behavior == ENEMY_WANDERER && i % 5 == 0) ? 2 : 1;
+
+        // Bounded retries; a crowded maze just gets fewer enemies
+        int tries;
+        for (tries = 0; tries < 64; tries++) {
+            int x = EnemySet_random(enemies_p) % maze_p->width;
+            int y = EnemySet_random(enemies_p) % maze_p->height;
+            int dx = x > game_p->start_x ? x - game_p->start_x : game_p->start_x - x;
+            int dy = y > game_p->start_y ? y - game_p->start_y : game_p->start_y - y;
+
+            if (dx + dy >= ENEMY_SAFE_DISTANCE &&
+                EnemySet_add(enemies_p, x, y, behavior, speed)) {
+                break;
+            }
+        }
+    }
+}
+
+// Move every enemy one turn; the player is caught if one steps on them
+static void takeEnemyTurn(MazeGame* game_p) {
+    DistField* field_p = game_p->pursuit_p;
+
+    // Advance the field by a fixed budget, so a turn costs the same on any
+    // maze and replays see the same field. A pass runs to its end before the
+    // next starts from where the player is now; restarting on every move
+    // would leave far cells pointing at the start forever. Nobody reads the
+    // field when hunters never chase.
+    if (game_p->chasePercent > 0) {
+        if (field_p->complete) {
+            DistField_setSource(field_p, game_p->player_x, game_p->player_y);
+        }
+        DistField_update(field_p, DISTFIELD_BUDGET);
+    }
+
+    if (EnemySet_takeTurn(&game_p->enemies, field_p, game_p->player_x,
+                          game_p->player_y, game_p->chasePercent)) {
+        game_p->state = GAME_OVER;
+    }
+}
+
+// Play on maze_p with up to enemyCount enemies
+void MazeGame_init(MazeGame* game_p, const Maze* maze_p, DistField* pursuit_p,
+                   MoveMask* moves_p, int enemyCount) {
+    game_p->maze_p = maze_p;
+    game_p->pursuit_p = pursuit_p;
+    game_p->moves_p = moves_p;
+    game_p->enemyCount = enemyCount;
+    game_p->chasePercent = 0;
+
+    game_p->start_x = maze_p->startX;
+    game_p->start_y = maze_p->startY;
+    game_p->player_x = game_p->start_x;
+    game_p->player_y = game_p->start_y;
+
+    // The first enemy guards the goal from two cells in, or one if that is a wall
+    game_p->enemyStart_x = maze_p->goalX - 2;
+    game_p->enemyStart_y = maze_p->goalY;
+    if (Maze_isWall(maze_p, game_p->enemyStart_x, game_p->enemyStart_y)) {
+        game_p->enemyStart_x = maze_p->goalX - 1;
+    }
+
+    game_p->spawnCount = 0;
+    MoveMask_build(moves_p, maze_p);
+    EnemySet_clear(&game_p->enemies, moves_p);
+    game_p->moveCount = 0;
+    game_p->state = GAME_RUNNING;
+}
+
+// Place exactly these enemies on every reset
+void MazeGame_setSpawns(MazeGame* game_p, const EnemySpawn* spawns_p, int count) {
+    if (count > MAZEGAME_MAX_SPAWNS) {
+        count = MAZEGAME_MAX_SPAWNS;
+    }
+
+    memcpy(game_p->spawns, spawns_p, count * sizeof(EnemySpawn));
+    game_p->spawnCount = count;
+    game_p->enemyCount = count;
+}
+
+// Start a new game from seed
+void MazeGame_reset(MazeGame* game_p, uint32_t seed, uint32_t chasePercent) {
+    game_p->chasePercent = chasePercent;
+    game_p->player_x = game_p->start_x;
+    game_p->player_y = game_p->start_y;
+    game_p->moveCount = 0;
+    game_p->state = GAME_RUNNING;
+
+    EnemySet_seed(&game_p->enemies, seed);
+    placeEnemies(game_p);
+
+    // A fresh field, so no distances carry over from an earlier game, and
+    // one full pass so the first turns have every distance
+    DistField_init(game_p->pursuit_p, game_p->maze_p);
+    if (chasePercent > 0) {
+        DistField_setSource(game_p->pursuit_p, game_p->player_x, game_p->player_y);
+        DistField_update(game_p->pursuit_p, DISTFIELD_MAX_CELLS);
+    }
+}
+
+// Whether key moves the player
+bool MazeGame_isMoveKey(char key) {
+    return key == 'U' || key == 'u' || key == 'D' || key == 'd' ||
+           key == 'L' || key == 'l' || key == 'R' || key == 'r';
+}
+
+// Play one key
+MazeStep MazeGame_step(MazeGame* game_p, char key) {
+    if (game_p->state != GAME_RUNNING) {
+        return MAZE_STEP_IGNORED;
+    }
+
+    int new_x = game_p->player_x;
+    int new_y = game_p->player_y;
+    MazeStep result = MAZE_STEP_MOVED;
+    MoveDir dir = MOVE_UP;
+
+    switch (key) {
+        case 'U': case 'u': dir = MOVE_UP; new_y--; break;
+        case 'D': case 'd': dir = MOVE_DOWN; new_y++; break;
+        case 'L': case 'l': dir = MOVE_LEFT; new_x--; break;
+        case 'R': case 'r': dir = MOVE_RIGHT; new_x++; break;
+        default: result = MAZE_STEP_IGNORED; break;
+    }
+
+    if (result == MAZE_STEP_MOVED) {
+        // The mask has no bit for walls or steps off the maze
+        int cell = game_p->player_y * game_p->maze_p->width + game_p->player_x;
+        if (!MoveMask_canMove(game_p->moves_p, cell, dir)) {
+            result = MAZE_STEP_BLOCKED;
+        } else {
+            game_p->player_x = new_x;
+            game_p->player_y = new_y;
+            game_p->moveCount++;
+
+            // Walking into an enemy ends the game just like being caught
+            if (EnemySet_isOccupied(&game_p->enemies, new_x, new_y)) {
+                game_p->state = GAME_OVER;
+                return result;
+            }
+
+            if (new_x == game_p->maze_p->goalX && new_y == game_p->maze_p->goalY) {
+                game_p->state = GAME_WIN;
+                return result;
+            }
+        }
+    }
+
+    takeEnemyTurn(game_p);
+    return result;
+}
+
+// FNV-1a over one 32-bit value
+static uint32_t hashWord(uint32_t hash, uint32_t value) {
+    int i;
+    for (i = 0; i < 4; i++) {
+        hash ^= (value >> (i * 8)) & 0xFF;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Checksum of the player, enemies, move count and state
+uint32_t MazeGame_hash(const MazeGame* game_p) {
+    uint32_t hash = 2166136261u;
+    int i;
+
+    hash = hashWord(hash, game_p->player_y * game_p->maze_p->width + game_p->player_x);
+    hash = hashWord(hash, game_p->moveCount);
+    hash = hashWord(hash, game_p->state);
+    for (i = 0; i < game_p->enemies.count; i++) {
+        hash = hashWord(hash, game_p->enemies.cell[i]);
+    }
+
+    return hash;
+}
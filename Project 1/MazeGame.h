@@ -0,0 +1,85 @@
+/*
+ * MazeGame.h - Rules of one maze game, with no hardware behind them
+ *
+ * A game is the player, the enemies and the win/lose state on one maze.
+ * Everything random comes from the seed given to MazeGame_reset, and the
+ * distance field the hunters follow advances by the same budget on every
+ * turn, so a game depends only on its maze, seed, difficulty and the keys
+ * passed to MazeGame_step.
+ * The LaunchPad feeds it UART keys; tools/maze_sim.c replays recorded logs
+ * and runs batches of games on a PC with the same code.
+ */
+
+#ifndef MAZEGAME_H_
+#define MAZEGAME_H_
+
+#include <EnemySet.h>
+
+// Game states
+typedef enum {
+    GAME_RUNNING,
+    GAME_WIN,
+    GAME_OVER
+} GameState;
+
+// What one key did to the player
+typedef enum {
+    MAZE_STEP_MOVED,
+    MAZE_STEP_BLOCKED,  // a wall or the maze edge; the enemies still move
+    MAZE_STEP_IGNORED   // not a move key; the enemies still move
+} MazeStep;
+
+// Most enemies a level can place by hand
+#define MAZEGAME_MAX_SPAWNS 16
+
+// An enemy placed by a level instead of at random
+typedef struct {
+    uint8_t x, y;
+    uint8_t behavior;  // EnemyBehavior
+    uint8_t speed;
+} EnemySpawn;
+
+typedef struct {
+    const Maze* maze_p;
+    DistField* pursuit_p;  // steps to the player, shared since it is large
+    MoveMask* moves_p;     // open directions per cell, shared likewise
+    EnemySet enemies;
+    int enemyCount;
+    uint32_t chasePercent;  // 0 to 100
+
+    int start_x, start_y;
+    int enemyStart_x, enemyStart_y;
+
+    // Hand-placed enemies; when there are none they are placed at random
+    EnemySpawn spawns[MAZEGAME_MAX_SPAWNS];
+    int spawnCount;
+
+    int player_x, player_y;
+    int moveCount;
+    GameState state;
+} MazeGame;
+
+// Play on maze_p with up to enemyCount enemies; pursuit_p is the field the
+// hunters follow and moves_p is filled with the maze's move masks. Call
+// MazeGame_reset before the first step.
+void MazeGame_init(MazeGame* game_p, const Maze* maze_p, DistField* pursuit_p,
+                   MoveMask* moves_p, int enemyCount);
+
+// Place exactly these enemies on every reset instead of random ones
+void MazeGame_setSpawns(MazeGame* game_p, const EnemySpawn* spawns_p, int count);
+
+// Start a new game. Enemy placement and every random enemy step follow
+// from seed; hunters chase chasePercent of their steps.
+void MazeGame_reset(MazeGame* game_p, uint32_t seed, uint32_t chasePercent);
+
+// Whether key moves the player (u/d/l/r in either case)
+bool MazeGame_isMoveKey(char key);
+
+// Play one key: move the player, then let the enemies take a turn unless the
+// game just ended. Does nothing once the game is over.
+MazeStep MazeGame_step(MazeGame* game_p, char key);
+
+// Checksum of the player, enemies, move count and state, to check replays
+uint32_t MazeGame_hash(const MazeGame* game_p);
+
+#endif /* MAZEGAME_H_ */
@@ -0,0 +1,139 @@
+/*
+ * MazeGen.c - Seeded random maze generator
+ */
+
+#include <MazeGen.h>
+
+// Direction from a room back to the room it was carved from
+typedef enum {
+    DIR_UP,
+    DIR_DOWN,
+    DIR_LEFT,
+    DIR_RIGHT
+} Direction;
+
+static const int8_t dirX[4] = { 0, 0, -1, 1 };
+static const int8_t dirY[4] = { -1, 1, 0, 0 };
+
+// Parent direction of every room, 2 bits each, replaces a recursion stack
+static uint8_t parentDir[MAZE_GEN_SCRATCH_BYTES];
+
+static uint32_t rngState;
+
+// xorshift32; plenty for picking among four directions
+static uint32_t nextRandom(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static void carve(MazeStorage* storage_p, int x, int y) {
+    storage_p->walls[y * storage_p->maze.rowWords + (x >> 5)] &= ~(1u << (x & 31));
+}
+
+static void setParent(int room, Direction dir) {
+    int shift = (room & 3) * 2;
+    parentDir[room >> 2] = (parentDir[room >> 2] & ~(3 << shift)) | (dir << shift);
+}
+
+static Direction getParent(int room) {
+    return (Direction)((parentDir[room >> 2] >> ((room & 3) * 2)) & 3);
+}
+
+// Generate a width x height maze into storage_p and return it
+const Maze* MazeGen_generate(MazeStorage* storage_p, int width, int height, uint32_t seed) {
+    if (width < MAZE_GEN_MIN) width = MAZE_GEN_MIN;
+    if (height < MAZE_GEN_MIN) height = MAZE_GEN_MIN;
+    if (width > MAZE_GEN_MAX) width = MAZE_GEN_MAX;
+    if (height > MAZE_GEN_MAX) height = MAZE_GEN_MAX;
+
+    Maze* maze_p = &storage_p->maze;
+    int roomsW = (width - 1) / 2;
+    int roomsH = (height - 1) / 2;
+
+    maze_p->width = width;
+    maze_p->height = height;
+    maze_p->rowWords = MAZE_ROW_WORDS(width);
+    maze_p->walls = storage_p->walls;
+
+    // Start solid; only the bits inside the maze width are set
+    int y, w;
+    for (y = 0; y < height; y++) {
+        for (w = 0; w < maze_p->rowWords; w++) {
+            int bits = width - w * 32;
+            storage_p->walls[y * maze_p->rowWords + w] =
+                bits >= 32 ? 0xFFFFFFFF : (1u << bits) - 1;
+        }
+    }
+
+    rngState = seed ? seed : 1;
+
+    // Walk from the bottom-left room, backing up along parent links at dead ends
+    int rootX = 0, rootY = roomsH - 1;
+    int cx = rootX, cy = rootY;
+    carve(storage_p, cx * 2 + 1, cy * 2 + 1);
+
+    while (true) {
+        Direction options[4];
+        int count = 0;
+        int d;
+
+        for (d = 0; d < 4; d++) {
+            int nx = cx + dirX[d];
+            int ny = cy + dirY[d];
+            if (nx >= 0 && nx < roomsW && ny >= 0 && ny < roomsH &&
+                Maze_isWall(maze_p, nx * 2 + 1, ny * 2 + 1)) {
+                options[count++] = (Direction)d;
+            }
+        }
+
+        if (count > 0) {
+            Direction dir = options[nextRandom() % count];
+            carve(storage_p, cx * 2 + 1 + dirX[dir], cy * 2 + 1 + dirY[dir]);
+            cx += dirX[dir];
+            cy += dirY[dir];
+            carve(storage_p, cx * 2 + 1, cy * 2 + 1);
+
+            // Opposite directions differ only in the low bit
+            setParent(cy * roomsW + cx, (Direction)(dir ^ 1));
+        } else if (cx == rootX && cy == rootY) {
+            break;
+        } else {
+            Direction back = getParent(cy * roomsW + cx);
+            cx += dirX[back];
+            cy += dirY[back];
+        }
+    }
+
+    // Open the start below the first room and the goal right of the top-right room
+    maze_p->startX = 1;
+    maze_p->startY = roomsH * 2;
+    maze_p->goalX = roomsW * 2;
+    maze_p->goalY = 1;
+    carve(storage_p, maze_p->startX, maze_p->startY);
+    carve(storage_p, maze_p->goalX, maze_p->goalY);
+
+    return maze_p;
+}
+
+// Knock out percent of the walls between two open cells in a line
+void MazeGen_braid(MazeStorage* storage_p, int percent, uint32_t seed) {
+    const Maze* maze_p = &storage_p->maze;
+    int x, y;
+
+    rngState = seed ? seed : 1;
+
+    for (y = 1; y < maze_p->height - 1; y++) {
+        for (x = 1; x < maze_p->width - 1; x++) {
+            if (!Maze_isWall(maze_p, x, y)) {
+                continue;
+            }
+            bool horizontal = !Maze_isWall(maze_p, x - 1, y) && !Maze_isWall(maze_p, x + 1, y);
+            bool vertical = !Maze_isWall(maze_p, x, y - 1) && !Maze_isWall(maze_p, x, y + 1);
+            if ((horizontal || vertical) && (int)(nextRandom() % 100) < percent) {
+                carve(storage_p, x, y);
+            }
+        }
+    }
+}
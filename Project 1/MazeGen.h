@@ -0,0 +1,38 @@
+/*
+ * MazeGen.h - Seeded random maze generator
+ *
+ * Builds a perfect maze (exactly one path between any two cells) with an
+ * iterative recursive backtracker. Rooms sit on odd coordinates with walls
+ * between them; the start opens through the bottom wall and the goal through
+ * the right wall. The same seed and size always give the same maze.
+ * MazeGen_braid can then knock out some walls to add loops.
+ */
+
+#ifndef MAZEGEN_H_
+#define MAZEGEN_H_
+
+#include <Maze.h>
+
+// Largest maze side in cells, and the smallest that still has a room
+#define MAZE_GEN_MAX 64
+#define MAZE_GEN_MIN 5
+
+// Bytes of static scratch the generator uses: 2 bits per room
+#define MAZE_GEN_SCRATCH_BYTES (((MAZE_GEN_MAX - 1) / 2) * ((MAZE_GEN_MAX - 1) / 2) / 4 + 1)
+
+// Room for the largest generated maze; walls point into this struct
+typedef struct {
+    Maze maze;
+    uint32_t walls[MAZE_GEN_MAX * MAZE_ROW_WORDS(MAZE_GEN_MAX)];
+} MazeStorage;
+
+// Generate a width x height maze into storage_p and return it.
+// Sizes are clamped to MAZE_GEN_MIN..MAZE_GEN_MAX.
+const Maze* MazeGen_generate(MazeStorage* storage_p, int width, int height, uint32_t seed);
+
+// Knock out percent of the walls that sit between two open cells in a line,
+// so the maze has loops and a blocked corridor has a way around. The outer
+// walls stay. The same maze, percent and seed always give the same walls.
+void MazeGen_braid(MazeStorage* storage_p, int percent, uint32_t seed);
+
+#endif /* MAZEGEN_H_ */
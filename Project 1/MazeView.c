@@ -0,0 +1,180 @@
+/*
+ * MazeView.c - Camera window onto a maze, drawn by repainting dirty cells
+ */
+
+#include <MazeView.h>
+
+// Slot contents: the cell type in bits 0-1 and the sprite in bits 2-3
+#define SPRITE_SHIFT 2
+#define SPRITE_NONE 0
+#define SPRITE_PLAYER 1
+#define SPRITE_ENEMY 2
+// Never produced by a composed slot, so an unknown slot always repaints
+#define SHOWN_UNKNOWN 0xFF
+
+#define PLAYER_COLOR 0x0000FF
+#define ENEMY_COLOR 0xFF0000
+
+// Radius 4 circle centered in a 10x10 cell, bit 0 is the leftmost pixel
+static const uint16_t spriteMask[MAZEVIEW_CELL_SIZE] = {
+    0x000, 0x0F8, 0x1FC, 0x3FE, 0x3FE, 0x3FE, 0x3FE, 0x3FE, 0x1FC, 0x0F8
+};
+
+// Screen color of a maze cell
+static uint32_t cellColor(MazeCell cell) {
+    switch (cell) {
+        case MAZE_WALL:  return 0xFF0000;  // Red for walls
+        case MAZE_START: return 0xFFFF00;  // Yellow for start
+        case MAZE_GOAL:  return 0x00FF00;  // Green for goal
+        default:         return 0xFFFFFF;  // White for path
+    }
+}
+
+// Camera position along one axis that keeps pos at least MAZEVIEW_MARGIN
+// cells from the window edge, clamped to the maze
+static int cameraFor(int camera, int pos, int view, int size) {
+    if (pos < camera + MAZEVIEW_MARGIN || pos >= camera + view - MAZEVIEW_MARGIN) {
+        // Recenter rather than creep, so scrolls happen rarely
+        camera = pos - view / 2;
+    }
+    if (camera > size - view) camera = size - view;
+    if (camera < 0) camera = 0;
+    return camera;
+}
+
+static void markAll(MazeView* view_p) {
+    int row;
+    for (row = 0; row < view_p->rows; row++) {
+        view_p->dirty[row] = (1u << view_p->cols) - 1;
+    }
+}
+
+// What maze cell (x, y) should look like right now
+static uint8_t compose(const MazeView* view_p, const EnemySet* enemies_p, int x, int y) {
+    uint8_t sprite = SPRITE_NONE;
+
+    // An enemy on the player's cell is drawn on top, as the game is over
+    if (EnemySet_isOccupied(enemies_p, x, y)) {
+        sprite = SPRITE_ENEMY;
+    } else if (x == view_p->player_x && y == view_p->player_y) {
+        sprite = SPRITE_PLAYER;
+    }
+
+    return Maze_cellAt(view_p->maze_p, x, y) | (sprite << SPRITE_SHIFT);
+}
+
+// Set the screen position of the window
+void MazeView_init(MazeView* view_p, int originX, int originY) {
+    view_p->originX = originX;
+    view_p->originY = originY;
+    view_p->maze_p = NULL;
+    view_p->cols = 0;
+    view_p->rows = 0;
+}
+
+// Show a new maze; the camera goes back to the top left
+void MazeView_attach(MazeView* view_p, const Maze* maze_p) {
+    view_p->maze_p = maze_p;
+    view_p->cols = maze_p->width < MAZEVIEW_COLS ? maze_p->width : MAZEVIEW_COLS;
+    view_p->rows = maze_p->height < MAZEVIEW_ROWS ? maze_p->height : MAZEVIEW_ROWS;
+    view_p->cameraX = 0;
+    view_p->cameraY = 0;
+    view_p->player_x = maze_p->startX;
+    view_p->player_y = maze_p->startY;
+    MazeView_invalidate(view_p);
+}
+
+// Forget what the LCD shows; the next flush repaints every slot
+void MazeView_invalidate(MazeView* view_p) {
+    int row, col;
+    for (row = 0; row < MAZEVIEW_ROWS; row++) {
+        for (col = 0; col < MAZEVIEW_COLS; col++) {
+            view_p->shown[row][col] = SHOWN_UNKNOWN;
+        }
+    }
+    markAll(view_p);
+}
+
+// Mark maze cell (x, y) for a repaint check; off-screen cells are ignored
+void MazeView_markCell(MazeView* view_p, int x, int y) {
+    unsigned col = x - view_p->cameraX;
+    unsigned row = y - view_p->cameraY;
+
+    if (col < (unsigned)view_p->cols && row < (unsigned)view_p->rows) {
+        view_p->dirty[row] |= 1u << col;
+    }
+}
+
+// Move the player sprite, marking the cells it left and entered
+void MazeView_setPlayer(MazeView* view_p, int x, int y) {
+    MazeView_markCell(view_p, view_p->player_x, view_p->player_y);
+    view_p->player_x = x;
+    view_p->player_y = y;
+    MazeView_markCell(view_p, x, y);
+}
+
+// Mark the old and new cell of every enemy that moved since oldCells
+void MazeView_markEnemies(MazeView* view_p, const EnemySet* enemies_p,
+                          const uint16_t* oldCells) {
+    int width = view_p->maze_p->width;
+    int i;
+
+    for (i = 0; i < enemies_p->count; i++) {
+        if (oldCells[i] != enemies_p->cell[i]) {
+            MazeView_markCell(view_p, oldCells[i] % width, oldCells[i] / width);
+            MazeView_markCell(view_p, enemies_p->cell[i] % width, enemies_p->cell[i] / width);
+        }
+    }
+}
+
+// Recenter the camera if the player is near an edge
+bool MazeView_follow(MazeView* view_p) {
+    int newX = cameraFor(view_p->cameraX, view_p->player_x, view_p->cols, view_p->maze_p->width);
+    int newY = cameraFor(view_p->cameraY, view_p->player_y, view_p->rows, view_p->maze_p->height);
+
+    if (newX == view_p->cameraX && newY == view_p->cameraY) {
+        return false;
+    }
+
+    view_p->cameraX = newX;
+    view_p->cameraY = newY;
+    markAll(view_p);
+    return true;
+}
+
+// Repaint dirty slots whose content changed; returns the number written
+int MazeView_flush(MazeView* view_p, const EnemySet* enemies_p, GFX* gfx_p) {
+    int written = 0;
+    int row, col;
+
+    for (row = 0; row < view_p->rows; row++) {
+        uint16_t bits = view_p->dirty[row];
+        view_p->dirty[row] = 0;
+
+        for (col = 0; bits != 0; col++, bits >>= 1) {
+            if (!(bits & 1)) {
+                continue;
+            }
+
+            uint8_t content = compose(view_p, enemies_p, view_p->cameraX + col,
+                                      view_p->cameraY + row);
+            if (content == view_p->shown[row][col]) {
+                continue;
+            }
+            view_p->shown[row][col] = content;
+
+            // Background and sprite go out together in one window write
+            uint8_t sprite = content >> SPRITE_SHIFT;
+            GFX_drawMaskedBlock(gfx_p,
+                view_p->originX + col * MAZEVIEW_CELL_SIZE,
+                view_p->originY + row * MAZEVIEW_CELL_SIZE,
+                MAZEVIEW_CELL_SIZE, MAZEVIEW_CELL_SIZE,
+                sprite == SPRITE_NONE ? NULL : spriteMask,
+                sprite == SPRITE_ENEMY ? ENEMY_COLOR : PLAYER_COLOR,
+                cellColor((MazeCell)(content & 3)));
+            written++;
+        }
+    }
+
+    return written;
+}
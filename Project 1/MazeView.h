@@ -0,0 +1,67 @@
+/*
+ * MazeView.h - Camera window onto a maze, drawn by repainting dirty cells
+ *
+ * The view remembers what each screen slot currently shows (cell type plus
+ * any sprite) and keeps one dirty bit per slot. Game code only marks the
+ * cells it touched; MazeView_flush composes each dirty slot and writes it
+ * to the LCD in a single block only if it differs from what is shown.
+ */
+
+#ifndef MAZEVIEW_H_
+#define MAZEVIEW_H_
+
+#include <HAL/Graphics.h>
+#include <EnemySet.h>
+
+// Cells of the maze shown at once; 12x10 cells of 10 pixels fill the LCD
+// below the move counter
+#define MAZEVIEW_COLS 12
+#define MAZEVIEW_ROWS 10
+#define MAZEVIEW_CELL_SIZE 10
+// The camera recenters when the player gets this close to a window edge
+#define MAZEVIEW_MARGIN 2
+
+typedef struct {
+    const Maze* maze_p;
+    int player_x, player_y;
+
+    // Top-left maze cell on screen, and the window size in cells
+    int cameraX, cameraY;
+    int cols, rows;
+
+    // Pixel position of the top-left slot
+    int originX, originY;
+
+    uint16_t dirty[MAZEVIEW_ROWS];                // one bit per column
+    uint8_t shown[MAZEVIEW_ROWS][MAZEVIEW_COLS];  // what the LCD holds
+} MazeView;
+
+// Set the screen position of the window
+void MazeView_init(MazeView* view_p, int originX, int originY);
+
+// Show a new maze; the camera goes back to the top left
+void MazeView_attach(MazeView* view_p, const Maze* maze_p);
+
+// Forget what the LCD shows, e.g. after it was cleared; the next flush
+// repaints every slot
+void MazeView_invalidate(MazeView* view_p);
+
+// Mark maze cell (x, y) for a repaint check; off-screen cells are ignored
+void MazeView_markCell(MazeView* view_p, int x, int y);
+
+// Move the player sprite, marking the cells it left and entered
+void MazeView_setPlayer(MazeView* view_p, int x, int y);
+
+// Mark the old and new cell of every enemy that moved since oldCells
+void MazeView_markEnemies(MazeView* view_p, const EnemySet* enemies_p,
+                          const uint16_t* oldCells);
+
+// Recenter the camera if the player is near an edge. A scroll marks every
+// slot; the flush still skips the ones that look the same. Returns true if
+// the camera moved.
+bool MazeView_follow(MazeView* view_p);
+
+// Repaint dirty slots whose content changed; returns the number written
+int MazeView_flush(MazeView* view_p, const EnemySet* enemies_p, GFX* gfx_p);
+
+#endif /* MAZEVIEW_H_ */
@@ -0,0 +1,49 @@
+/*
+ * MoveMask.c - Open directions of every maze cell, built once per maze
+ */
+
+#include <MoveMask.h>
+#include <string.h>
+
+static const int8_t stepX[4] = { 0, 0, -1, 1 };
+static const int8_t stepY[4] = { -1, 1, 0, 0 };
+
+const uint8_t MoveMask_countTable[16] = {
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+};
+
+const uint8_t MoveMask_selectTable[16] = {
+    0x00, 0x00, 0x01, 0x04, 0x02, 0x08, 0x09, 0x24,
+    0x03, 0x0C, 0x0D, 0x34, 0x0E, 0x38, 0x39, 0xE4
+};
+
+// Build the masks of every cell of maze_p; walls get an empty mask
+void MoveMask_build(MoveMask* moves_p, const Maze* maze_p) {
+    int width = maze_p->width;
+    int cell = 0;
+    int x, y, d;
+
+    moves_p->maze_p = maze_p;
+    moves_p->delta[MOVE_UP] = -width;
+    moves_p->delta[MOVE_DOWN] = width;
+    moves_p->delta[MOVE_LEFT] = -1;
+    moves_p->delta[MOVE_RIGHT] = 1;
+    memset(moves_p->masks, 0, (width * maze_p->height + 1) / 2);
+
+    for (y = 0; y < maze_p->height; y++) {
+        for (x = 0; x < width; x++, cell++) {
+            if (Maze_isWall(maze_p, x, y)) {
+                continue;
+            }
+
+            // Cells outside the maze count as walls, so edges need no check
+            uint8_t mask = 0;
+            for (d = 0; d < 4; d++) {
+                if (!Maze_isWall(maze_p, x + stepX[d], y + stepY[d])) {
+                    mask |= 1 << d;
+                }
+            }
+            moves_p->masks[cell >> 1] |= mask << ((cell & 1) << 2);
+        }
+    }
+}
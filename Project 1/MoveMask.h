@@ -0,0 +1,56 @@
+/*
+ * MoveMask.h - Open directions of every maze cell, built once per maze
+ *
+ * Each cell gets a 4-bit mask with bit d set when a step in direction d
+ * stays on an open cell, two cells to a byte. Checking a move is then one
+ * bit test on a cell index, and picking a random open direction is a count
+ * and a select through 16-entry tables instead of testing every neighbor.
+ * Steps move a cell index by delta[d], so nothing divides by the width.
+ */
+
+#ifndef MOVEMASK_H_
+#define MOVEMASK_H_
+
+#include <MazeGen.h>
+
+// Step directions; bit d of a mask is direction d
+typedef enum {
+    MOVE_UP,
+    MOVE_DOWN,
+    MOVE_LEFT,
+    MOVE_RIGHT
+} MoveDir;
+
+typedef struct {
+    const Maze* maze_p;
+    int16_t delta[4];  // change of the cell index for each direction
+    uint8_t masks[MAZE_GEN_MAX * MAZE_GEN_MAX / 2];
+} MoveMask;
+
+// Open directions in each 4-bit mask, and the index of the nth one:
+// bits 2n..2n+1 of MoveMask_selectTable[mask]
+extern const uint8_t MoveMask_countTable[16];
+extern const uint8_t MoveMask_selectTable[16];
+
+// Build the masks of every cell of maze_p
+void MoveMask_build(MoveMask* moves_p, const Maze* maze_p);
+
+static inline uint8_t MoveMask_at(const MoveMask* moves_p, int cell) {
+    return (moves_p->masks[cell >> 1] >> ((cell & 1) << 2)) & 0x0F;
+}
+
+static inline bool MoveMask_canMove(const MoveMask* moves_p, int cell, MoveDir dir) {
+    return (MoveMask_at(moves_p, cell) >> dir) & 1;
+}
+
+// Number of open directions in mask
+static inline int MoveMask_count(uint8_t mask) {
+    return MoveMask_countTable[mask];
+}
+
+// The nth open direction of mask, counting from MOVE_UP; n < MoveMask_count
+static inline MoveDir MoveMask_select(uint8_t mask, int n) {
+    return (MoveDir)((MoveMask_selectTable[mask] >> (n << 1)) & 3);
+}
+
+#endif /* MOVEMASK_H_ */
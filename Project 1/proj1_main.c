@@ -1,13 +1,20 @@
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <stdio.h>
 #include <string.h>
 #include <Application.h>
+#include <HAL/Format.h>
 #include <HAL/HAL.h>
+#include <HAL/LcdMirror.h>
+#include <HAL/Random.h>
+#include <DistField.h>
+#include <InputLog.h>
+#include <LevelPack.h>
+#include <MazeGame.h>
+#include <MazeGen.h>
+#include <ScoreLog.h>
 #include <HAL/Timer.h>
 #include <HAL/Graphics.h>
-#include <stdlib.h>
 
 // Set up non-blocking LED on P1.0
 static void InitNonBlockingLED() {
@@ -23,13 +30,35 @@ static void PollNonBlockingLED() {
     }
 }
 
+// Seeds for random mazes and for the enemies, as separate streams
+static Random mazeSeeds;
+static Random enemySeeds;
+
+// Start both seed streams from the boot seed
+static void seedRandom(uint32_t seed) {
+    Random_init(&mazeSeeds, seed, 0);
+    Random_init(&enemySeeds, seed, 1);
+}
+
+// The application, its terminal grids and the game with its enemies are
+// too big for the 512-byte stack
+static Application app;
+static TermView termView;
+static MazeGame mazeGame;
+
 int main(void) {
     WDT_A_holdTimer();
     InitSystemTiming();
+    seedRandom(Random_bootSeed());
     HAL hal = HAL_construct();
-    Application app = Application_construct();
+    Application_init(&app);
     InitNonBlockingLED();
 
+#if LCD_MIRROR_ENABLED
+    // Mirror every screen update to the PC; see tools/lcdmirror_view.c
+    LcdMirror_attach(&hal.uart);
+#endif
+
     App_Screen_showmainmenu(&app, &hal.gfx);
 
     while (true) {
@@ -44,36 +73,59 @@ uint32_t CircularIncrement(uint32_t value, uint32_t maximum) {
     return (value + 1) % maximum;
 }
 
+// Storage for the maze being played, generated or loaded from the level pack
+static MazeStorage mazeStorage;
+
+// Steps from every cell to the player, for the hunting enemies
+static DistField pursuit;
+
+// Open directions of every cell of the current maze
+static MoveMask moveMasks;
+
+// Best move counts, saved in flash across resets
+static ScoreLog scoreLog;
+
+// Keys of the current game, sent with 'l' once it ends
+static InputLog inputLog;
+
+// Percent of enemy steps that chase instead of wandering, per difficulty
+static const uint8_t chaseChance[NUM_ENEMY_MODES] = { 0, 60, 90 };
+static const char* enemyModeNames[NUM_ENEMY_MODES] = { "Random", "Mixed ", "Chase " };
+
 // Set up initial application state
-Application Application_construct() {
-    Application app;
-    app.baudChoice = BAUD_9600;
-    app.firstCall = true;
-    app.state = MAIN_MENU;
-    app.arrow = CURSOR_0;
-    app.gamePromptSent = false;
-    app.player_x = 15;
-    app.player_y = 123;
-    app.borderOffsetX = 0;
-    app.borderOffsetY = 28;
-    app.blockWidth = 10;
-    app.blockHeight = 10;
-    app.mazeDrawn = false;
-    app.start_y = 123;
-    app.start_x = 15;
-    app.enemy_x = 75;
-    app.enemy_y = 43;
-    app.moveCount = 0;
-    app.gameState = GAME_RUNNING;
-    app.gameEndScreenShown = false;
-
-    // 9999 means empty slot
-    int i;
-    for (i = 0; i < MAX_HIGH_SCORES; i++) {
-        app.highScores[i] = 9999;
-    }
+void Application_init(Application* app_p) {
+    app_p->baudChoice = BAUD_9600;
+    app_p->autoBaud = true;
+    app_p->autoBaudMeasuring = false;
+    app_p->firstCall = true;
+    app_p->state = MAIN_MENU;
+    app_p->arrow = CURSOR_0;
+    app_p->enemyMode = ENEMY_MIXED;
+    app_p->level = 0;
+    app_p->gamePromptSent = false;
+    app_p->game_p = &mazeGame;
+    MazeView_init(&app_p->view, 0, 28);
+    Application_useMaze(app_p, &Maze_default);
+    app_p->gameEndScreenShown = false;
+    app_p->commandLineMode = false;
+    app_p->commandLength = 0;
+    app_p->termView = false;
+    app_p->termMessageShown = false;
+    app_p->term_p = &termView;
 
-    return app;
+    // Fewest moves is best; scores from before the reset come back from flash
+    ScoreLog_open(&scoreLog, true);
+    loadHighScores(app_p);
+}
+
+// Switch to a maze; positions are in cells and the camera starts at the start
+void Application_useMaze(Application* app_p, const Maze* maze_p) {
+    // Generated mazes get a crowd; levels replace it with their own enemies
+    MazeGame_init(app_p->game_p, maze_p, &pursuit, &moveMasks, RANDOM_MAZE_ENEMIES);
+    MazeView_attach(&app_p->view, maze_p);
+
+    app_p->mazeSize = 0;
+    app_p->mazeSeed = 0;
 }
 
 // Main loop - handles all menu states
@@ -86,11 +138,11 @@ void Application_loop(Application* app_p, HAL* hal_p) {
             App_Screen_handleInstructionsScreen(app_p, hal_p);
             break;
         case START_GAME:
-            if (app_p->gameState == GAME_RUNNING) {
+            if (app_p->game_p->state == GAME_RUNNING) {
                 App_Screen_handleGameScreen(app_p, hal_p);
-            } else if (app_p->gameState == GAME_WIN) {
+            } else if (app_p->game_p->state == GAME_WIN) {
                 App_Screen_showGameWin(app_p, &hal_p->gfx);
-            } else if (app_p->gameState == GAME_OVER) {
+            } else if (app_p->game_p->state == GAME_OVER) {
                 App_Screen_showGameOver(app_p, &hal_p->gfx);
             }
             break;
@@ -103,11 +155,11 @@ void Application_loop(Application* app_p, HAL* hal_p) {
 
     // BB1 returns to main menu after game ends
     if (Button_isTapped(&hal_p->boosterpackS1)) {
-        if (app_p->gameState == GAME_OVER || app_p->gameState == GAME_WIN) {
+        if (app_p->game_p->state == GAME_OVER || app_p->game_p->state == GAME_WIN) {
             app_p->gameEndScreenShown = false;
             app_p->state = MAIN_MENU;
             App_Screen_showmainmenu(app_p, &hal_p->gfx);
-            app_p->gameState = GAME_RUNNING;
+            app_p->game_p->state = GAME_RUNNING;
         }
     }
 
@@ -116,32 +168,77 @@ void Application_loop(Application* app_p, HAL* hal_p) {
         Application_updateCommunications(app_p, hal_p);
     }
 
+    if (app_p->autoBaud) {
+        Application_updateAutoBaud(app_p, hal_p);
+    }
+
     // Echo received UART characters
     if (UART_hasChar(&hal_p->uart)) {
         char rxChar = UART_getChar(&hal_p->uart);
         char txChar = Application_interpretIncomingChar(rxChar);
 
-        if (UART_canSend(&hal_p->uart)) {
+        if (app_p->state == START_GAME && app_p->game_p->state != GAME_RUNNING &&
+            (rxChar == 'l' || rxChar == 'L')) {
+            sendInputLog(app_p, hal_p);
+        } else if (UART_canSend(&hal_p->uart)) {
             UART_sendChar(&hal_p->uart, rxChar);
         }
     }
 }
 
 // Update baud rate and show LED indicator
+// BB2 cycles 9600 -> 19200 -> 38400 -> 57600 -> auto -> 9600
 void Application_updateCommunications(Application* app_p, HAL* hal_p) {
     if (app_p->firstCall) {
         app_p->firstCall = false;
+    } else if (app_p->autoBaud) {
+        if (app_p->autoBaudMeasuring) {
+            UART_cancelAutoBaud(&hal_p->uart);
+            app_p->autoBaudMeasuring = false;
+        }
+        app_p->autoBaud = false;
+        app_p->baudChoice = BAUD_9600;
+    } else if (app_p->baudChoice == NUM_BAUD_CHOICES - 1) {
+        // Auto mode keeps the current rate until a mismatch shows up
+        app_p->autoBaud = true;
     } else {
         uint32_t newBaudNumber = CircularIncrement((uint32_t)app_p->baudChoice, NUM_BAUD_CHOICES);
         app_p->baudChoice = (UART_Baudrate)newBaudNumber;
     }
 
     UART_SetBaud_Enable(&hal_p->uart, app_p->baudChoice);
+    Application_showBaudLED(app_p, hal_p);
+}
+
+// Re-detect the host baud rate after a receive error, then switch to it
+void Application_updateAutoBaud(Application* app_p, HAL* hal_p) {
+    if (app_p->autoBaudMeasuring) {
+        UART_Baudrate detected;
+        if (UART_autoBaudDone(&hal_p->uart, &detected)) {
+            app_p->autoBaudMeasuring = false;
+            app_p->baudChoice = detected;
+            UART_SetBaud_Enable(&hal_p->uart, app_p->baudChoice);
+            Application_showBaudLED(app_p, hal_p);
+        }
+    } else if (UART_hasRxError(&hal_p->uart)) {
+        app_p->autoBaudMeasuring = true;
+        UART_startAutoBaud(&hal_p->uart);
+        Application_showBaudLED(app_p, hal_p);
+    }
+}
+
+// LED color shows current baud rate, magenta while auto-baud is measuring
+void Application_showBaudLED(Application* app_p, HAL* hal_p) {
     LED_turnOff(&hal_p->launchpadLED2Red);
     LED_turnOff(&hal_p->launchpadLED2Green);
     LED_turnOff(&hal_p->launchpadLED2Blue);
 
-    // LED color shows current baud rate
+    if (app_p->autoBaudMeasuring) {
+        LED_turnOn(&hal_p->launchpadLED2Red);
+        LED_turnOn(&hal_p->launchpadLED2Blue);
+        return;
+    }
+
     switch (app_p->baudChoice) {
         case BAUD_9600:
             LED_turnOff(&hal_p->launchpadLED2Green);
@@ -185,14 +282,27 @@ void App_Screen_updatemainmenu(Application* app_p, GFX* gfx_p) {
     GFX_print(gfx_p, "  ", 4, 0);
     GFX_print(gfx_p, "  ", 5, 0);
     GFX_print(gfx_p, "  ", 6, 0);
+    GFX_print(gfx_p, "  ", 7, 0);
+    GFX_print(gfx_p, "  ", 8, 0);
+    GFX_print(gfx_p, "  ", 9, 0);
     GFX_print(gfx_p, ">", 4 + app_p->arrow, 0);
 }
 
+// Show the chosen level as "n/total" on the main menu
+static void App_Screen_showLevelChoice(Application* app_p, GFX* gfx_p) {
+    char text[12];
+    char* p = text;
+    p += Format_uint(p, app_p->level + 1, 2, ' ');
+    p += Format_string(p, "/");
+    Format_uint(p, Levels_count, 0, ' ');
+    GFX_print(gfx_p, text, 9, 11);
+}
+
 // Handle main menu navigation
 void App_Screen_handlemainmenu(Application* app_p, HAL* hal_p) {
     if (Button_isTapped(&hal_p->launchpadS1)) {
         if (app_p->arrow == CURSOR_0) {
-            app_p->arrow = CURSOR_2;
+            app_p->arrow = CURSOR_5;
         } else {
             app_p->arrow = (Cursor)(app_p->arrow - 1);
         }
@@ -200,7 +310,7 @@ void App_Screen_handlemainmenu(Application* app_p, HAL* hal_p) {
     }
 
     if (Button_isTapped(&hal_p->launchpadS2)) {
-        if (app_p->arrow == CURSOR_2) {
+        if (app_p->arrow == CURSOR_5) {
             app_p->arrow = CURSOR_0;
         } else {
             app_p->arrow = (Cursor)(app_p->arrow + 1);
@@ -213,7 +323,7 @@ void App_Screen_handlemainmenu(Application* app_p, HAL* hal_p) {
         switch (app_p->arrow) {
             case CURSOR_0:
                 app_p->state = START_GAME;
-                resetGame(app_p, hal_p);
+                startLevel(app_p, hal_p);
                 break;
             case CURSOR_1:
                 app_p->state = SEE_INSTRUCTIONS;
@@ -223,6 +333,20 @@ void App_Screen_handlemainmenu(Application* app_p, HAL* hal_p) {
                 app_p->state = SEE_HIGHSCORE;
                 App_Screen_showHighScoreScreen(app_p, &hal_p->gfx);
                 break;
+            case CURSOR_3:
+                app_p->state = START_GAME;
+                startRandomMaze(app_p, hal_p);
+                break;
+            case CURSOR_4:
+                // Cycle the difficulty in place
+                app_p->enemyMode = (EnemyMode)CircularIncrement(app_p->enemyMode, NUM_ENEMY_MODES);
+                GFX_print(&hal_p->gfx, (char*)enemyModeNames[app_p->enemyMode], 8, 11);
+                break;
+            case CURSOR_5:
+                // Pick the level "Play Game" starts
+                app_p->level = CircularIncrement(app_p->level, Levels_count);
+                App_Screen_showLevelChoice(app_p, &hal_p->gfx);
+                break;
             default:
                 break;
         }
@@ -245,25 +369,63 @@ void App_Screen_handleHighScoreScreen(Application* app_p, HAL* hal_p) {
     }
 }
 
+// Play one key and record it, with the time since the game started
+static MazeStep App_playKey(Application* app_p, char key) {
+    uint32_t time_ms = SWTimer_elapsedCycles(&app_p->gameClock) /
+                       (SYSTEM_CLOCK / MS_DIVISION_FACTOR);
+
+    InputLog_record(&inputLog, time_ms, key);
+    return MazeGame_step(app_p->game_p, key);
+}
+
 // Handle game input and logic
 void App_Screen_handleGameScreen(Application* app_p, HAL* hal_p) {
-    if (app_p->gameState != GAME_RUNNING)
+    if (app_p->game_p->state != GAME_RUNNING)
         return;
 
     if (!app_p->gamePromptSent) {
-        showNextMovePrompt(hal_p);
+        showNextMovePrompt(app_p, hal_p);
         app_p->gamePromptSent = true;
     }
 
     if (UART_hasChar(&hal_p->uart)) {
         char rxChar = UART_getChar(&hal_p->uart);
 
-        if (isValidPlayerCommand(rxChar)) {
+        int oldPlayer_x = app_p->game_p->player_x;
+        int oldPlayer_y = app_p->game_p->player_y;
+        uint16_t oldEnemyCells[MAX_ENEMIES];
+        memcpy(oldEnemyCells, app_p->game_p->enemies.cell, sizeof(oldEnemyCells));
+
+        if (app_p->commandLineMode) {
+            handleCommandLineChar(app_p, hal_p, rxChar);
+        } else if (rxChar == ':') {
+            // Start buffering a move string
+            app_p->commandLineMode = true;
+            app_p->commandLength = 0;
+            if (app_p->termView) {
+                App_Term_showCommandLine(app_p);
+            } else {
+                UART_sendChar(&hal_p->uart, ':');
+            }
+        } else if (rxChar == 't' || rxChar == 'T') {
+            toggleTermView(app_p, hal_p);
+        } else if (MazeGame_isMoveKey(rxChar)) {
             processPlayerCommand(app_p, hal_p, rxChar);
         } else {
-            notifyInvalidInput(hal_p);
-            moveEnemy(app_p, hal_p);
-            showNextMovePrompt(hal_p);
+            // A wrong key still gives the enemies their turn
+            notifyInvalidInput(app_p, hal_p);
+            App_playKey(app_p, rxChar);
+            showNextMovePrompt(app_p, hal_p);
+        }
+
+        // End screens repaint everything, so only redraw while still playing
+        if (app_p->game_p->state == GAME_RUNNING) {
+            App_Screen_refresh(app_p, &hal_p->gfx, oldEnemyCells);
+        }
+
+        // Only the cells that changed go out to the terminal
+        if (app_p->termView && app_p->game_p->state == GAME_RUNNING) {
+            App_Term_update(app_p, oldPlayer_x, oldPlayer_y, oldEnemyCells);
         }
     }
 
@@ -272,61 +434,260 @@ void App_Screen_handleGameScreen(Application* app_p, HAL* hal_p) {
     }
 }
 
-// Check for valid movement commands
-bool isValidPlayerCommand(char c) {
-    return c == 'U' || c == 'u' || c == 'D' || c == 'd' ||
-           c == 'L' || c == 'l' || c == 'R' || c == 'r';
-}
-
 // Move player based on input
 void processPlayerCommand(Application* app_p, HAL* hal_p, char rxChar) {
-    int new_x = app_p->player_x;
-    int new_y = app_p->player_y;
+    MazeStep step = App_playKey(app_p, rxChar);
 
-    // Check collision with enemy
-    if (new_x == app_p->enemy_x && new_y == app_p->enemy_y) {
-        app_p->gameState = GAME_OVER;
+    // The end screens take over once the game is decided
+    if (app_p->game_p->state != GAME_RUNNING) {
         return;
     }
 
-    // Calculate new position
-    switch (rxChar) {
-        case 'U': case 'u': new_y -= 10; break;
-        case 'D': case 'd': new_y += 10; break;
-        case 'L': case 'l': new_x -= 10; break;
-        case 'R': case 'r': new_x += 10; break;
+    if (step == MAZE_STEP_MOVED) {
+        if (!app_p->termView && UART_canSend(&hal_p->uart)) {
+            UART_sendChar(&hal_p->uart, rxChar);
+            UART_sendChar(&hal_p->uart, '\r');
+        } else if (app_p->termView && app_p->termMessageShown) {
+            // Clear a stale "Blocked" once the player moves again
+            TermView_print(app_p->term_p, 1, 0, "");
+            app_p->termMessageShown = false;
+        }
+    } else {
+        notifyInvalidMove(app_p, hal_p);
     }
 
-    if (isValidMove(app_p, &hal_p->gfx, new_x, new_y)) {
-        App_Screen_updateGameScreen(app_p, &hal_p->gfx, new_x, new_y);
-        app_p->moveCount++;
+    showNextMovePrompt(app_p, hal_p);
+}
+
+// Buffer one character of a move string; Enter runs the whole line
+void handleCommandLineChar(Application* app_p, HAL* hal_p, char rxChar) {
+    if (rxChar == '\r' || rxChar == '\n') {
+        app_p->commandLine[app_p->commandLength] = '\0';
+        app_p->commandLineMode = false;
+        if (app_p->termView) {
+            TermView_print(app_p->term_p, 2, 0, "");
+        } else {
+            UART_sendString(&hal_p->uart, "");
+        }
+        runMoveString(app_p, hal_p, app_p->commandLine);
+        return;
+    }
 
-        if (UART_canSend(&hal_p->uart)) {
+    // Backspace or delete removes the last buffered character. The terminal
+    // view redraws its line; a plain terminal gets "\b \b" without the line
+    // end UART_sendString would add.
+    if (rxChar == '\b' || rxChar == 0x7F) {
+        if (app_p->commandLength > 0) {
+            app_p->commandLength--;
+            if (app_p->termView) {
+                App_Term_showCommandLine(app_p);
+            } else {
+                const char* erase = "\b \b";
+                while (*erase && UART_waitToSend(&hal_p->uart)) {
+                    UART_sendChar(&hal_p->uart, *erase++);
+                }
+            }
+        }
+        return;
+    }
+
+    if (app_p->commandLength < COMMAND_LINE_MAX) {
+        app_p->commandLine[app_p->commandLength++] = rxChar;
+        if (app_p->termView) {
+            App_Term_showCommandLine(app_p);
+        } else if (UART_waitToSend(&hal_p->uart)) {
             UART_sendChar(&hal_p->uart, rxChar);
-            UART_sendChar(&hal_p->uart, '\r');
         }
+    }
+}
+
+// Check that a move string only holds optional counts followed by moves
+static bool isValidMoveString(const char* moves) {
+    bool haveMove = false;
+    int count = 0;
+
+    while (*moves) {
+        if (*moves >= '0' && *moves <= '9') {
+            count = count * 10 + (*moves - '0');
+            if (count > MAX_MOVE_REPEAT) {
+                return false;
+            }
+        } else if (MazeGame_isMoveKey(*moves)) {
+            count = 0;
+            haveMove = true;
+        } else {
+            return false;
+        }
+        moves++;
+    }
+
+    // A trailing count with no move letter is an error
+    return haveMove && count == 0;
+}
+
+// Run a move string such as "3u2r" as one batch; the screen is redrawn once
+// when handleGameScreen finishes the key
+void runMoveString(Application* app_p, HAL* hal_p, const char* moves) {
+    if (!isValidMoveString(moves)) {
+        notifyInvalidInput(app_p, hal_p);
+        showNextMovePrompt(app_p, hal_p);
+        return;
+    }
+
+    int stepsRun = 0;
+    int blocked = 0;
+    int count = 0;
+
+    while (*moves && app_p->game_p->state == GAME_RUNNING) {
+        if (*moves >= '0' && *moves <= '9') {
+            count = count * 10 + (*moves - '0');
+            moves++;
+            continue;
+        }
+
+        if (count == 0) {
+            count = 1;
+        }
+
+        while (count > 0 && app_p->game_p->state == GAME_RUNNING) {
+            if (App_playKey(app_p, *moves) == MAZE_STEP_BLOCKED) {
+                blocked++;
+            }
+            stepsRun++;
+            count--;
+        }
+
+        count = 0;
+        moves++;
+    }
+
+    char summary[64];
+    char* p = summary;
+    p += Format_string(p, "Ran ");
+    p += Format_int(p, stepsRun, 0, ' ');
+    p += Format_string(p, " moves, ");
+    p += Format_int(p, blocked, 0, ' ');
+    p += Format_string(p, " blocked, total ");
+    p += Format_int(p, app_p->game_p->moveCount, 0, ' ');
+    if (app_p->game_p->state == GAME_WIN) {
+        Format_string(p, " - goal reached!");
+    } else if (app_p->game_p->state == GAME_OVER) {
+        Format_string(p, " - caught!");
+    }
+
+    if (app_p->termView) {
+        App_Term_message(app_p, summary);
+    } else {
+        UART_sendString(&hal_p->uart, summary);
+    }
+
+    if (app_p->game_p->state == GAME_RUNNING) {
+        showNextMovePrompt(app_p, hal_p);
+    }
+}
+
+// Generate a new random maze and start a game in it
+void startRandomMaze(Application* app_p, HAL* hal_p) {
+    uint32_t seed = Random_next(&mazeSeeds);
+
+    MazeGen_generate(&mazeStorage, RANDOM_MAZE_SIZE, RANDOM_MAZE_SIZE, seed);
+    MazeGen_braid(&mazeStorage, RANDOM_MAZE_BRAID_PERCENT, seed);
+    Application_useMaze(app_p, &mazeStorage.maze);
+    app_p->mazeSize = RANDOM_MAZE_SIZE;
+    app_p->mazeSeed = seed;
+    resetGame(app_p, hal_p);
+
+    char line[48];
+    char* p = line;
+    p += Format_string(p, "Random maze ");
+    p += Format_uint(p, app_p->game_p->maze_p->width, 0, ' ');
+    p += Format_string(p, "x");
+    p += Format_uint(p, app_p->game_p->maze_p->height, 0, ' ');
+    p += Format_string(p, ", seed ");
+    Format_uint(p, seed, 0, ' ');
+    if (app_p->termView) {
+        App_Term_message(app_p, line);
     } else {
-        notifyInvalidMove(hal_p);
+        UART_sendString(&hal_p->uart, line);
     }
+}
+
+// Load the chosen level from the pack and start a game in it
+void startLevel(Application* app_p, HAL* hal_p) {
+    EnemySpawn spawns[MAZEGAME_MAX_SPAWNS];
+    int spawnCount;
 
-    moveEnemy(app_p, hal_p);
-    showNextMovePrompt(hal_p);
+    Application_useMaze(app_p, LevelPack_load(&mazeStorage, app_p->level,
+                                              spawns, &spawnCount));
+    MazeGame_setSpawns(app_p->game_p, spawns, spawnCount);
+    app_p->mazeSize = 0;
+    app_p->mazeSeed = app_p->level;
+    resetGame(app_p, hal_p);
 }
 
-// Show movement prompt via UART
-void showNextMovePrompt(HAL* hal_p) {
+// Switch between the text prompts and the terminal maze view
+void toggleTermView(Application* app_p, HAL* hal_p) {
+    if (app_p->termView) {
+        TermView_end(app_p->term_p);
+        app_p->termView = false;
+        showNextMovePrompt(app_p, hal_p);
+    } else {
+        TermView_init(app_p->term_p, &hal_p->uart, app_p->view.rows, app_p->view.cols);
+        app_p->termView = true;
+        App_Term_show(app_p);
+    }
+}
+
+// Show movement prompt via UART; the terminal view has its own help line
+void showNextMovePrompt(Application* app_p, HAL* hal_p) {
+    if (app_p->termView) {
+        return;
+    }
+
     UART_sendString(&hal_p->uart,
-        "\r\nEnter movement u=up, l=left, d=down, r=right (U/L/D/R or u/l/d/r):\r\n");
+        "\r\nEnter movement u=up, l=left, d=down, r=right (U/L/D/R or u/l/d/r):\r\n"
+        "or ':' then a move string like 3u2r and Enter, 't' for a terminal maze view");
 }
 
 // Tell user move was invalid
-void notifyInvalidMove(HAL* hal_p) {
+void notifyInvalidMove(Application* app_p, HAL* hal_p) {
+    if (app_p->termView) {
+        App_Term_message(app_p, "Blocked by a wall.");
+        return;
+    }
+
     UART_sendString(&hal_p->uart,
         "Invalid move! Player would go out of bounds or hit a wall.");
 }
 
+// Send the finished game's keys so tools/maze_sim.c can replay it exactly
+void sendInputLog(Application* app_p, HAL* hal_p) {
+    char line[INPUTLOG_LINE_MAX];
+    int i;
+
+    InputLog_formatHeader(line, &inputLog);
+    UART_sendString(&hal_p->uart, line);
+    for (i = 0; i < inputLog.count; i++) {
+        InputLog_formatEvent(line, &inputLog.events[i]);
+        UART_sendString(&hal_p->uart, line);
+    }
+
+    // Keys past the end were not kept, so the replay cannot reach the end state
+    if (inputLog.overflow) {
+        UART_sendString(&hal_p->uart, "TRUNCATED");
+    }
+
+    InputLog_formatEnd(line, app_p->game_p);
+    UART_sendString(&hal_p->uart, line);
+}
+
 // Tell user input was invalid
-void notifyInvalidInput(HAL* hal_p) {
+void notifyInvalidInput(Application* app_p, HAL* hal_p) {
+    if (app_p->termView) {
+        App_Term_message(app_p, "Invalid input! Use u/l/d/r, ':' or 't'.");
+        return;
+    }
+
     UART_sendString(&hal_p->uart,
         "Invalid input! Use only U/L/D/R or u/l/d/r.");
 }
@@ -334,19 +695,32 @@ void notifyInvalidInput(HAL* hal_p) {
 // Reset game to starting state
 void resetGame(Application* app_p, HAL* hal_p) {
     app_p->gamePromptSent = false;
-    app_p->mazeDrawn = false;
     app_p->gameEndScreenShown = false;
-    app_p->moveCount = 0;
+    app_p->commandLineMode = false;
+    app_p->commandLength = 0;
+
+    uint32_t seed = Random_next(&enemySeeds);
+    uint32_t chasePercent = chaseChance[app_p->enemyMode];
+
+    MazeGame_reset(app_p->game_p, seed, chasePercent);
+    InputLog_start(&inputLog, app_p->mazeSize, app_p->mazeSeed, seed,
+                   app_p->game_p->enemyCount, chasePercent);
+    app_p->gameClock = SWTimer_construct(0);
+    SWTimer_start(&app_p->gameClock);
 
-    app_p->player_x = app_p->start_x;
-    app_p->player_y = app_p->start_y;
-    app_p->enemy_x = 75;
-    app_p->enemy_y = 43;
+    // Frame the start before anything is drawn
+    app_p->view.cameraX = 0;
+    app_p->view.cameraY = 0;
+    MazeView_setPlayer(&app_p->view, app_p->game_p->player_x, app_p->game_p->player_y);
+    MazeView_follow(&app_p->view);
 
     GFX_clear(&hal_p->gfx);
     App_Screen_showGameScreen(app_p, &hal_p->gfx);
 
-    app_p->gameState = GAME_RUNNING;
+    if (app_p->termView) {
+        TermView_init(app_p->term_p, app_p->term_p->uart_p, app_p->view.rows, app_p->view.cols);
+        App_Term_show(app_p);
+    }
 }
 
 // Draw main menu screen
@@ -361,10 +735,15 @@ void App_Screen_showmainmenu(Application* app_p, GFX* gfx_p) {
     GFX_print(gfx_p, "Play Game", 4, 4);
     GFX_print(gfx_p, "Instructions", 5, 4);
     GFX_print(gfx_p, "High Score", 6, 4);
+    GFX_print(gfx_p, "Random Maze", 7, 4);
+    GFX_print(gfx_p, "Enemy:", 8, 4);
+    GFX_print(gfx_p, (char*)enemyModeNames[app_p->enemyMode], 8, 11);
+    GFX_print(gfx_p, "Level:", 9, 4);
+    App_Screen_showLevelChoice(app_p, gfx_p);
 
-    GFX_print(gfx_p, "LB1 to go up", 8, 2);
-    GFX_print(gfx_p, "LB2 to go down", 9, 2);
-    GFX_print(gfx_p, "BB1 to select", 10, 2);
+    GFX_print(gfx_p, "LB1 to go up", 10, 2);
+    GFX_print(gfx_p, "LB2 to go down", 11, 2);
+    GFX_print(gfx_p, "BB1 to select", 12, 2);
 
     GFX_print(gfx_p, ">", 4 + app_p->arrow, 0);
 }
@@ -378,13 +757,11 @@ void App_Screen_showHighScoreScreen(Application* app_p, GFX* gfx_p) {
 
     int i;
     for (i = 0; i < MAX_HIGH_SCORES; i++) {
-        char scoreText[20];
         if (app_p->highScores[i] == 9999) {
-            snprintf(scoreText, sizeof(scoreText), "--");
+            GFX_print(gfx_p, "--", 5 + i, 10);
         } else {
-            snprintf(scoreText, sizeof(scoreText), "%d", app_p->highScores[i]);
+            GFX_printInt(gfx_p, app_p->highScores[i], 0, 5 + i, 10);
         }
-        GFX_print(gfx_p, scoreText, 5 + i, 10);
     }
 
     GFX_print(gfx_p, "Press BB1 to return.", 11, 1);
@@ -410,267 +787,153 @@ void App_Screen_showInstructionsScreen(Application* app_p, GFX* gfx_p) {
 void App_Screen_showGameScreen(Application* app_p, GFX* gfx_p) {
     GFX_clear(gfx_p);
 
-    if (!app_p->mazeDrawn) {
-        showMaze(app_p, gfx_p);
-        app_p->mazeDrawn = true;
-    }
+    // The LCD was just cleared, so every cell of the window is painted
+    MazeView_invalidate(&app_p->view);
+    MazeView_flush(&app_p->view, &app_p->game_p->enemies, gfx_p);
 
     GFX_setForeground(gfx_p, 0xFFFFFF);
-    GFX_print(gfx_p, "Moves: 0", 0, 6);
-
-    // Draw player (blue)
-    GFX_setForeground(gfx_p, 0x0000FF);
-    Graphics_fillCircle(&gfx_p->context, app_p->player_x, app_p->player_y, 4);
-
-    App_Screen_updateEnemy(app_p, gfx_p, app_p->enemy_x, app_p->enemy_y);
-}
-
-// Update player position on screen
-void App_Screen_updateGameScreen(Application* app_p, GFX* gfx_p, int new_x, int new_y) {
-    // Clear old position
-    GFX_removeSolidCircle(gfx_p, app_p->player_x, app_p->player_y, 4);
-
-    int old_x = app_p->player_x;
-    int old_y = app_p->player_y;
-
-    int blockWidth = app_p->blockWidth;
-    int blockHeight = app_p->blockHeight;
-
-    int adjusted_old_x = old_x - (blockWidth / 2);
-    int adjusted_old_y = old_y - (blockHeight / 2);
-
-    int oldMaze_x = (adjusted_old_x - app_p->borderOffsetX) / blockWidth;
-    int oldMaze_y = (adjusted_old_y - app_p->borderOffsetY) / blockHeight;
-    int newMaze_x = (new_x - app_p->borderOffsetX) / blockWidth;
-    int newMaze_y = (new_y - app_p->borderOffsetY) / blockHeight;
-
-    // Redraw background if moved to new cell
-    if (oldMaze_x != newMaze_x || oldMaze_y != newMaze_y) {
+    GFX_print(gfx_p, "Moves: ", 0, 6);
+    GFX_printInt(gfx_p, app_p->game_p->moveCount, 0, 0, 13);
+    app_p->movesShown = app_p->game_p->moveCount;
+}
+
+// Repaint what the last key changed. The view marks the cells the player and
+// enemies left and entered, and writes only those whose contents differ from
+// what the LCD already shows.
+void App_Screen_refresh(Application* app_p, GFX* gfx_p, const uint16_t* oldEnemyCells) {
+    MazeView_setPlayer(&app_p->view, app_p->game_p->player_x, app_p->game_p->player_y);
+    MazeView_markEnemies(&app_p->view, &app_p->game_p->enemies, oldEnemyCells);
+    MazeView_follow(&app_p->view);
+    MazeView_flush(&app_p->view, &app_p->game_p->enemies, gfx_p);
+
+    // "Moves: " stays on screen; only the count is reprinted, and only when it changed
+    if (app_p->movesShown != app_p->game_p->moveCount) {
         GFX_setForeground(gfx_p, 0xFFFFFF);
-        GFX_drawSolidRectangle(gfx_p, adjusted_old_x, adjusted_old_y, blockWidth, blockHeight);
+        GFX_printInt(gfx_p, app_p->game_p->moveCount, 0, 0, 13);
+        app_p->movesShown = app_p->game_p->moveCount;
     }
-
-    app_p->player_x = new_x;
-    app_p->player_y = new_y;
-
-    // Update move counter display
-    char movesText[20];
-    GFX_setForeground(gfx_p, 0xFFFFFF);
-    snprintf(movesText, sizeof(movesText), "Moves: %d", app_p->moveCount);
-    GFX_print(gfx_p, movesText, 0, 6);
-
-    // Draw player at new position (blue)
-    GFX_setForeground(gfx_p, 0x0000FF);
-    Graphics_fillCircle(&gfx_p->context, app_p->player_x, app_p->player_y, 4);
-
-    App_Screen_updateEnemy(app_p, gfx_p, app_p->enemy_x, app_p->enemy_y);
 }
 
-// Update enemy position on screen
-void App_Screen_updateEnemy(Application* app_p, GFX* gfx_p, int new_x, int new_y) {
-    // Clear old position
-    GFX_removeSolidCircle(gfx_p, app_p->enemy_x, app_p->enemy_y, 4);
-
-    int old_x = app_p->enemy_x;
-    int old_y = app_p->enemy_y;
-
-    int blockWidth = app_p->blockWidth;
-    int blockHeight = app_p->blockHeight;
-
-    int adjusted_old_x = old_x - (blockWidth / 2);
-    int adjusted_old_y = old_y - (blockHeight / 2);
-
-    int oldMaze_x = (adjusted_old_x - app_p->borderOffsetX) / blockWidth;
-    int oldMaze_y = (adjusted_old_y - app_p->borderOffsetY) / blockHeight;
-    int newMaze_x = (new_x - app_p->borderOffsetX) / blockWidth;
-    int newMaze_y = (new_y - app_p->borderOffsetY) / blockHeight;
-
-    // Redraw background if moved to new cell
-    if (oldMaze_x != newMaze_x || oldMaze_y != newMaze_y) {
-        GFX_setForeground(gfx_p, 0xFFFFFF);
-        GFX_drawSolidRectangle(gfx_p, adjusted_old_x, adjusted_old_y, blockWidth, blockHeight);
-    }
-
-    app_p->enemy_x = new_x;
-    app_p->enemy_y = new_y;
-
-    // Draw enemy at new position (red)
-    GFX_setForeground(gfx_p, 0xFF0000);
-    Graphics_fillCircle(&gfx_p->context, app_p->enemy_x, app_p->enemy_y, 4);
-}
-
-// Draw the maze grid
-void showMaze(Application* app_p, GFX* gfx_p) {
-    char maze[10][10] = {
-        { 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', '_', '_', 'G' },
-        { 'X', '_', 'X', 'X', 'X', '_', '_', '_', '_', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', 'X', '_', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', 'X', '_', 'X' },
-        { 'X', '_', '_', 'X', 'X', '_', '_', '_', '_', 'X' },
-        { 'X', '_', '_', '_', 'X', 'X', 'X', '_', '_', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', 'X', '_', 'X' },
-        { 'X', '_', 'X', 'X', '_', '_', '_', '_', '_', 'X' },
-        { 'X', 'S', 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X' }
-    };
-
+// Set the terminal grid's backgrounds to the maze under the camera
+static void App_Term_showMaze(Application* app_p) {
+    const Maze* maze_p = app_p->game_p->maze_p;
     int j, k;
 
-    for (j = 0; j < 10; j++) {
-        for (k = 0; k < 10; k++) {
-            if (maze[j][k] == 'X') {
-                GFX_setForeground(gfx_p, 0xFF0000);  // Red for walls
-            } else if (maze[j][k] == 'S') {
-                GFX_setForeground(gfx_p, 0xFFFF00);  // Yellow for start
-            } else if (maze[j][k] == 'G') {
-                GFX_setForeground(gfx_p, 0x00FF00);  // Green for goal
+    for (j = 0; j < app_p->view.rows; j++) {
+        for (k = 0; k < app_p->view.cols; k++) {
+            MazeCell cell = Maze_cellAt(maze_p, app_p->view.cameraX + k, app_p->view.cameraY + j);
+
+            if (cell == MAZE_WALL) {
+                TermView_setBase(app_p->term_p, j, k, "##", TERM_RED);
+            } else if (cell == MAZE_START) {
+                TermView_setBase(app_p->term_p, j, k, "::", TERM_YELLOW);
+            } else if (cell == MAZE_GOAL) {
+                TermView_setBase(app_p->term_p, j, k, "[]", TERM_GREEN);
             } else {
-                GFX_setForeground(gfx_p, 0xFFFFFF);  // White for path
+                TermView_setBase(app_p->term_p, j, k, "  ", TERM_DEFAULT);
             }
-
-            GFX_drawSolidRectangle(gfx_p,
-                app_p->borderOffsetX + (k * app_p->blockWidth),
-                app_p->borderOffsetY + (j * app_p->blockHeight),
-                app_p->blockWidth,
-                app_p->blockHeight);
         }
     }
 }
 
-// Check if player can move to new position
-bool isValidMove(Application* app_p, GFX* gfx_p, int new_x, int new_y){
-    char maze[10][10] = {
-        { 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', '_', '_', 'G' },
-        { 'X', '_', 'X', 'X', 'X', '_', '_', '_', '_', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', 'X', '_', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', 'X', '_', 'X' },
-        { 'X', '_', '_', 'X', 'X', '_', '_', '_', '_', 'X' },
-        { 'X', '_', '_', '_', 'X', 'X', 'X', '_', '_', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', 'X', '_', 'X' },
-        { 'X', '_', 'X', 'X', '_', '_', '_', '_', '_', 'X' },
-        { 'X', 'S', 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X' }
-    };
-
-    // Check bounds
-    if (new_x < app_p->borderOffsetX || new_x >= (app_p->borderOffsetX + 10 * app_p->blockWidth) ||
-        new_y < app_p->borderOffsetY || new_y >= (app_p->borderOffsetY + 10 * app_p->blockHeight)) {
-        return false;
-    }
+// Show whatever is on maze cell (x, y) on the terminal
+static void App_Term_syncCell(Application* app_p, int x, int y) {
+    int row = y - app_p->view.cameraY;
+    int col = x - app_p->view.cameraX;
 
-    int maze_x = (new_x - app_p->borderOffsetX) / app_p->blockWidth;
-    int maze_y = (new_y - app_p->borderOffsetY) / app_p->blockHeight;
-
-    // Check if reached goal
-    if (maze[maze_y][maze_x] == 'G') {
-        app_p->gameState = GAME_WIN;
-        return true;
+    if (EnemySet_isOccupied(&app_p->game_p->enemies, x, y)) {
+        TermView_put(app_p->term_p, row, col, "<>", TERM_RED);
+    } else if (x == app_p->game_p->player_x && y == app_p->game_p->player_y) {
+        TermView_put(app_p->term_p, row, col, "()", TERM_BLUE);
+    } else {
+        TermView_putBase(app_p->term_p, row, col);
     }
+}
 
-    // Check if hit wall
-    if (maze[maze_y][maze_x] == 'X') {
-        return false;
-    }
+// Draw the whole terminal view: grid, sprites and status lines
+void App_Term_show(Application* app_p) {
+    TermView_begin(app_p->term_p);
+    App_Term_showMaze(app_p);
+    app_p->termCameraX = app_p->view.cameraX;
+    app_p->termCameraY = app_p->view.cameraY;
 
-    return true;
+    TermView_print(app_p->term_p, 0, 0, "Moves: ");
+    App_Term_update(app_p, app_p->game_p->player_x, app_p->game_p->player_y, app_p->game_p->enemies.cell);
+    TermView_print(app_p->term_p, 1, 0, "u/d/l/r move, ':' move string, 't' text prompts");
+    app_p->termMessageShown = false;
 }
 
-// Check if enemy can move to new position
-bool isenemyValidMove(Application* app_p, GFX* gfx_p, int enemy_new_x, int enemy_new_y){
-    char maze[10][10] = {
-        { 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', '_', '_', 'G' },
-        { 'X', '_', 'X', 'X', 'X', '_', '_', '_', '_', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', 'X', '_', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', 'X', '_', 'X' },
-        { 'X', '_', '_', 'X', 'X', '_', '_', '_', '_', 'X' },
-        { 'X', '_', '_', '_', 'X', 'X', 'X', '_', '_', 'X' },
-        { 'X', '_', '_', '_', '_', '_', '_', 'X', '_', 'X' },
-        { 'X', '_', 'X', 'X', '_', '_', '_', '_', '_', 'X' },
-        { 'X', 'S', 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X' }
-    };
+// Send only the cells the last move touched, plus the move count
+void App_Term_update(Application* app_p, int oldPlayer_x, int oldPlayer_y,
+                     const uint16_t* oldEnemyCells) {
+    EnemySet* enemies_p = &app_p->game_p->enemies;
+    int width = app_p->game_p->maze_p->width;
+    int i;
 
-    // Check bounds
-    if (enemy_new_x < app_p->borderOffsetX || enemy_new_x >= (app_p->borderOffsetX + 10 * app_p->blockWidth) ||
-        enemy_new_y < app_p->borderOffsetY || enemy_new_y >= (app_p->borderOffsetY + 10 * app_p->blockHeight)) {
-        return false;
+    // After a scroll, resend the backgrounds; the shadow skips matching cells
+    if (app_p->termCameraX != app_p->view.cameraX || app_p->termCameraY != app_p->view.cameraY) {
+        App_Term_showMaze(app_p);
+        app_p->termCameraX = app_p->view.cameraX;
+        app_p->termCameraY = app_p->view.cameraY;
     }
 
-    int maze_x = (enemy_new_x - app_p->borderOffsetX) / app_p->blockWidth;
-    int maze_y = (enemy_new_y - app_p->borderOffsetY) / app_p->blockHeight;
-
-    // Check if hit wall
-    if (maze[maze_y][maze_x] == 'X') {
-        return false;
+    // Cells that already look right cost nothing, so every enemy is synced
+    App_Term_syncCell(app_p, oldPlayer_x, oldPlayer_y);
+    for (i = 0; i < enemies_p->count; i++) {
+        App_Term_syncCell(app_p, oldEnemyCells[i] % width, oldEnemyCells[i] / width);
+    }
+    App_Term_syncCell(app_p, app_p->game_p->player_x, app_p->game_p->player_y);
+    for (i = 0; i < enemies_p->count; i++) {
+        App_Term_syncCell(app_p, enemies_p->cell[i] % width, enemies_p->cell[i] / width);
     }
 
-    return true;
+    char count[FORMAT_MAX_INT_LEN];
+    Format_int(count, app_p->game_p->moveCount, 0, ' ');
+    TermView_print(app_p->term_p, 0, 7, count);
 }
 
-// Move enemy randomly
-void moveEnemy(Application* app_p, HAL* hal_p) {
-    int directions[4][2] = {
-        {0, -10},  // Up
-        {0, 10},   // Down
-        {-10, 0},  // Left
-        {10, 0}    // Right
-    };
-
-    while (true) {
-        int choice = rand() % 4;
-        int dx = directions[choice][0];
-        int dy = directions[choice][1];
+// Show a one-line message under the grid
+void App_Term_message(Application* app_p, const char* text) {
+    TermView_print(app_p->term_p, 1, 0, text);
+    app_p->termMessageShown = true;
+}
 
-        int new_x = app_p->enemy_x + dx;
-        int new_y = app_p->enemy_y + dy;
+// Show the move string typed so far on the terminal view's command line
+void App_Term_showCommandLine(Application* app_p) {
+    char line[COMMAND_LINE_MAX + 2];
 
-        // Check if enemy caught player
-        if (new_x == app_p->player_x && new_y == app_p->player_y) {
-            app_p->gameState = GAME_OVER;
-            return;
-        }
-
-        if (isenemyValidMove(app_p, &hal_p->gfx, new_x, new_y)) {
-            App_Screen_updateEnemy(app_p, &hal_p->gfx, new_x, new_y);
-            app_p->enemy_x = new_x;
-            app_p->enemy_y = new_y;
-            break;
-        }
-    }
+    line[0] = ':';
+    memcpy(line + 1, app_p->commandLine, app_p->commandLength);
+    line[app_p->commandLength + 1] = '\0';
+    TermView_print(app_p->term_p, 2, 0, line);
 }
 
 // Show win screen and save high score
 void App_Screen_showGameWin(Application* app_p, GFX* gfx_p) {
-    if (app_p->gameState == GAME_WIN && !app_p->gameEndScreenShown) {
-        int i;
-        int j;
-
-        // Insert score if it's good enough
-        for (i = 0; i < MAX_HIGH_SCORES; i++) {
-            if (app_p->moveCount < app_p->highScores[i]) {
-                for (j = MAX_HIGH_SCORES - 1; j > i; j--) {
-                    app_p->highScores[j] = app_p->highScores[j - 1];
-                }
-                app_p->highScores[i] = app_p->moveCount;
-                break;
-            }
+    if (app_p->game_p->state == GAME_WIN && !app_p->gameEndScreenShown) {
+        // A score that makes the table is appended to the flash log
+        if (ScoreLog_add(&scoreLog, app_p->game_p->moveCount)) {
+            loadHighScores(app_p);
         }
 
-        sortHighScores(app_p);
-
         GFX_clear(gfx_p);
         GFX_setForeground(gfx_p, 0xFFFFFF);
         GFX_print(gfx_p, "Congratulations!", 5, 2);
         GFX_print(gfx_p, "You reached the goal!", 6, 1);
         GFX_print(gfx_p, "Press BB1 to return.", 8, 2);
 
+        if (app_p->termView) {
+            App_Term_message(app_p, "You reached the goal! Press BB1 to return.");
+            TermView_end(app_p->term_p);
+        }
+
         app_p->gameEndScreenShown = true;
     }
 }
 
 // Show game over screen
 void App_Screen_showGameOver(Application* app_p, GFX* gfx_p) {
-    if (app_p->gameState == GAME_OVER && !app_p->gameEndScreenShown) {
+    if (app_p->game_p->state == GAME_OVER && !app_p->gameEndScreenShown) {
         GFX_clear(gfx_p);
         GFX_setForeground(gfx_p, 0xFFFFFF);
         GFX_print(gfx_p, "Game Over!", 5, 4);
@@ -678,20 +941,19 @@ void App_Screen_showGameOver(Application* app_p, GFX* gfx_p) {
         GFX_print(gfx_p, "Try again.", 7, 4);
         GFX_print(gfx_p, "Press BB1 to return.", 9, 2);
 
+        if (app_p->termView) {
+            App_Term_message(app_p, "You were caught! Press BB1 to return.");
+            TermView_end(app_p->term_p);
+        }
+
         app_p->gameEndScreenShown = true;
     }
 }
 
-// Sort high scores (lowest is best)
-void sortHighScores(Application* app_p) {
-    int i, j;
-    for (i = 0; i < MAX_HIGH_SCORES - 1; i++) {
-        for (j = i + 1; j < MAX_HIGH_SCORES; j++) {
-            if (app_p->highScores[i] > app_p->highScores[j]) {
-                int temp = app_p->highScores[i];
-                app_p->highScores[i] = app_p->highScores[j];
-                app_p->highScores[j] = temp;
-            }
-        }
+// Copy the saved table for the high score screen; 9999 marks an empty slot
+void loadHighScores(Application* app_p) {
+    int i;
+    for (i = 0; i < MAX_HIGH_SCORES; i++) {
+        app_p->highScores[i] = i < scoreLog.count ? scoreLog.best[i] : 9999;
     }
 }
@@ -0,0 +1,94 @@
+/*
+ * lcdmirror_view.c - Rebuilds the LCD image from a LcdMirror UART stream
+ *
+ * Host tool, not part of the firmware. Build and run with:
+ *
+ *   cc -O2 -o lcdmirror_view tools/lcdmirror_view.c
+ *   stty -F /dev/ttyACM0 9600 raw && ./lcdmirror_view screen.ppm < /dev/ttyACM0
+ *
+ * Bytes outside of mirror packets are the game's normal terminal output and
+ * are copied to stderr. The image is rewritten every 64 fills and at the end
+ * of the stream, so an image viewer that reloads on change shows it live.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LCD_SIZE 128
+#define SYNC 0xA5
+#define FILL_ARGS 6
+#define FILLS_PER_WRITE 64
+
+static uint16_t screen[LCD_SIZE][LCD_SIZE];
+
+static void writeImage(const char* path) {
+    FILE* out = fopen(path, "wb");
+    if (out == NULL) {
+        perror(path);
+        exit(1);
+    }
+    fprintf(out, "P6\n%d %d\n255\n", LCD_SIZE, LCD_SIZE);
+    int x, y;
+    for (y = 0; y < LCD_SIZE; y++) {
+        for (x = 0; x < LCD_SIZE; x++) {
+            uint16_t c = screen[y][x];
+            // Expand RGB565 to 8 bits per channel
+            fputc(((c >> 11) & 0x1F) * 255 / 31, out);
+            fputc(((c >> 5) & 0x3F) * 255 / 63, out);
+            fputc((c & 0x1F) * 255 / 31, out);
+        }
+    }
+    fclose(out);
+}
+
+static void fill(const uint8_t* a) {
+    int x0 = a[0], y0 = a[1], x1 = a[2], y1 = a[3];
+    uint16_t color = (uint16_t)((a[4] << 8) | a[5]);
+    int x, y;
+    if (x1 >= LCD_SIZE) x1 = LCD_SIZE - 1;
+    if (y1 >= LCD_SIZE) y1 = LCD_SIZE - 1;
+    for (y = y0; y <= y1; y++) {
+        for (x = x0; x <= x1; x++) {
+            screen[y][x] = color;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s out.ppm < stream\n", argv[0]);
+        return 2;
+    }
+
+    uint8_t args[FILL_ARGS];
+    long fills = 0, drops = 0;
+    int c;
+    while ((c = getchar()) != EOF) {
+        if (c != SYNC) {
+            fputc(c, stderr);
+            continue;
+        }
+
+        int type = getchar();
+        if (type == 'D') {
+            drops++;
+            continue;
+        }
+        if (type != 'F') {
+            fprintf(stderr, "\n[lcdmirror: unknown packet 0x%02X]\n", type);
+            continue;
+        }
+        if (fread(args, 1, FILL_ARGS, stdin) != FILL_ARGS) {
+            break;
+        }
+        fill(args);
+        if (++fills % FILLS_PER_WRITE == 0) {
+            writeImage(argv[1]);
+        }
+    }
+
+    writeImage(argv[1]);
+    fprintf(stderr, "\n[lcdmirror: %ld fills, %ld drop notices]\n", fills, drops);
+    return 0;
+}
@@ -0,0 +1,287 @@
+/*
+ * levelc.c - Level compiler: text maps to the flash level pack
+ *
+ * Host tool, not part of the firmware. Build and run from the project folder:
+ *
+ *   cc -O2 -I. -o levelc tools/levelc.c
+ *   ./levelc levels/levels.txt > Levels.c
+ *
+ * The input is one map per block of lines, blocks separated by blank lines;
+ * a ';' starts a comment. Map characters:
+ *
+ *   #  wall          .  open (a space works too)
+ *   S  start         G  goal
+ *   H  hunter        W  wanderer      F  fast wanderer
+ *
+ * Every map needs exactly one S and one G and must be rectangular. Each
+ * level is stored in whichever wall form (bit-packed or run-length, see
+ * LevelPack.h) is shorter. A summary of the sizes goes to stderr.
+ */
+
+#include <LevelPack.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEVELS 255
+#define MAX_PACK_BYTES 65535
+
+typedef struct {
+    int width, height;
+    int startX, startY, goalX, goalY;
+    int spawnCount;
+    EnemySpawn spawns[MAZEGAME_MAX_SPAWNS];
+    uint8_t wall[MAZE_GEN_MAX * MAZE_GEN_MAX];
+    int firstLine;
+} TextLevel;
+
+static uint8_t pack[MAX_PACK_BYTES];
+static int packSize;
+static uint16_t offsets[MAX_LEVELS];
+static int levelCount;
+static const char* inputPath;
+
+static void fail(int line, const char* message) {
+    fprintf(stderr, "%s:%d: %s\n", inputPath, line, message);
+    exit(1);
+}
+
+static void emit(int value) {
+    if (packSize >= MAX_PACK_BYTES) {
+        fail(0, "level pack over 64 KB");
+    }
+    pack[packSize++] = (uint8_t)value;
+}
+
+// One run length: a byte under 128, otherwise two bytes, high bits first
+static int runBytes(uint8_t* out, int run) {
+    if (run < 0x80) {
+        out[0] = (uint8_t)run;
+        return 1;
+    }
+    out[0] = (uint8_t)(0x80 | (run >> 8));
+    out[1] = (uint8_t)(run & 0xFF);
+    return 2;
+}
+
+// Walls as alternating wall/open runs, starting with walls
+static int encodeRuns(const TextLevel* level_p, uint8_t* out) {
+    int cells = level_p->width * level_p->height;
+    int length = 0;
+    int wall = 1;
+    int cell = 0;
+
+    while (cell < cells) {
+        int run = 0;
+        while (cell + run < cells && level_p->wall[cell + run] == wall) {
+            run++;
+        }
+        length += runBytes(out + length, run);
+        cell += run;
+        wall = !wall;
+    }
+    return length;
+}
+
+// Walls as one bit per cell, row by row, LSB first
+static int encodeBits(const TextLevel* level_p, uint8_t* out) {
+    int cells = level_p->width * level_p->height;
+    int length = (cells + 7) / 8;
+    int cell;
+
+    memset(out, 0, length);
+    for (cell = 0; cell < cells; cell++) {
+        if (level_p->wall[cell]) {
+            out[cell >> 3] |= 1 << (cell & 7);
+        }
+    }
+    return length;
+}
+
+static void addLevel(const TextLevel* level_p) {
+    static uint8_t runs[MAZE_GEN_MAX * MAZE_GEN_MAX * 2];
+    static uint8_t bits[MAZE_GEN_MAX * MAZE_GEN_MAX / 8];
+    int i;
+
+    if (level_p->startX < 0) fail(level_p->firstLine, "map has no start (S)");
+    if (level_p->goalX < 0) fail(level_p->firstLine, "map has no goal (G)");
+    if (levelCount >= MAX_LEVELS) fail(level_p->firstLine, "too many levels");
+
+    int runLength = encodeRuns(level_p, runs);
+    int bitLength = encodeBits(level_p, bits);
+    bool useRuns = runLength < bitLength;
+
+    offsets[levelCount++] = (uint16_t)packSize;
+    emit(level_p->width);
+    emit(level_p->height);
+    emit(level_p->startX);
+    emit(level_p->startY);
+    emit(level_p->goalX);
+    emit(level_p->goalY);
+    emit(useRuns ? LEVELPACK_RUNS : 0);
+    emit(level_p->spawnCount);
+    for (i = 0; i < level_p->spawnCount; i++) {
+        emit(level_p->spawns[i].x);
+        emit(level_p->spawns[i].y);
+        emit(level_p->spawns[i].behavior | (level_p->spawns[i].speed << 4));
+    }
+
+    const uint8_t* walls = useRuns ? runs : bits;
+    int length = useRuns ? runLength : bitLength;
+    for (i = 0; i < length; i++) {
+        emit(walls[i]);
+    }
+
+    fprintf(stderr, "level %2d: %2dx%-2d %2d enemies, %4d bytes (%s; bits %d, runs %d)\n",
+            levelCount, level_p->width, level_p->height, level_p->spawnCount,
+            packSize - offsets[levelCount - 1], useRuns ? "runs" : "bits",
+            bitLength, runLength);
+}
+
+// Add one row to the map being read
+static void readRow(TextLevel* level_p, const char* row, int length, int lineNumber) {
+    int y = level_p->height;
+    int x;
+
+    if (y == 0) {
+        level_p->width = length;
+        level_p->firstLine = lineNumber;
+    } else if (length != level_p->width) {
+        fail(lineNumber, "rows of a map must all be the same length");
+    }
+    if (length > MAZE_GEN_MAX || y >= MAZE_GEN_MAX) {
+        fail(lineNumber, "map is larger than 64x64");
+    }
+
+    for (x = 0; x < length; x++) {
+        uint8_t* wall_p = &level_p->wall[y * length + x];
+        *wall_p = 0;
+
+        switch (row[x]) {
+            case '#':
+                *wall_p = 1;
+                break;
+            case '.': case ' ':
+                break;
+            case 'S':
+                if (level_p->startX >= 0) fail(lineNumber, "map has two starts");
+                level_p->startX = x;
+                level_p->startY = y;
+                break;
+            case 'G':
+                if (level_p->goalX >= 0) fail(lineNumber, "map has two goals");
+                level_p->goalX = x;
+                level_p->goalY = y;
+                break;
+            case 'H': case 'W': case 'F': {
+                if (level_p->spawnCount >= MAZEGAME_MAX_SPAWNS) {
+                    fail(lineNumber, "map has more than 16 enemies");
+                }
+                EnemySpawn* spawn_p = &level_p->spawns[level_p->spawnCount++];
+                spawn_p->x = x;
+                spawn_p->y = y;
+                spawn_p->behavior = row[x] == 'H' ? ENEMY_HUNTER : ENEMY_WANDERER;
+                spawn_p->speed = row[x] == 'F' ? 2 : 1;
+                break;
+            }
+            default:
+                fail(lineNumber, "unknown map character");
+        }
+    }
+    level_p->height++;
+}
+
+static void startLevel(TextLevel* level_p) {
+    level_p->width = 0;
+    level_p->height = 0;
+    level_p->startX = level_p->goalX = -1;
+    level_p->spawnCount = 0;
+}
+
+static void printPack(void) {
+    int i;
+
+    printf("/*\n"
+           " * Levels.c - Level pack compiled from levels/levels.txt\n"
+           " *\n"
+           " * Generated by tools/levelc.c; edit the text maps and regenerate instead\n"
+           " * of changing this file. The format is described in LevelPack.h.\n"
+           " */\n\n"
+           "#include <LevelPack.h>\n\n");
+
+    printf("const int Levels_count = %d;\n\n", levelCount);
+
+    printf("const uint16_t Levels_offsets[%d] = {", levelCount);
+    for (i = 0; i < levelCount; i++) {
+        printf("%s%d", i % 12 == 0 ? "\n    " : " ", offsets[i]);
+        if (i < levelCount - 1) putchar(',');
+    }
+    printf("\n};\n\n");
+
+    printf("const uint8_t Levels_data[%d] = {", packSize);
+    for (i = 0; i < packSize; i++) {
+        printf("%s0x%02X", i % 12 == 0 ? "\n    " : " ", pack[i]);
+        if (i < packSize - 1) putchar(',');
+    }
+    printf("\n};\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <levels.txt>\n", argv[0]);
+        return 2;
+    }
+
+    inputPath = argv[1];
+    FILE* file = fopen(inputPath, "r");
+    if (!file) {
+        perror(inputPath);
+        return 2;
+    }
+
+    static TextLevel level;
+    char line[256];
+    int lineNumber = 0;
+
+    startLevel(&level);
+    while (fgets(line, sizeof(line), file)) {
+        lineNumber++;
+
+        // Comments run to the end of the line; spaces are open cells, so
+        // only the line ending is trimmed
+        char* comment = strchr(line, ';');
+        if (comment) {
+            *comment = '\0';
+            // A comment-only line does not end a map
+            if (comment == line) {
+                continue;
+            }
+        }
+        int length = strlen(line);
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r')) {
+            length--;
+        }
+
+        if (length == 0) {
+            if (level.height > 0) {
+                addLevel(&level);
+            }
+            startLevel(&level);
+        } else {
+            readRow(&level, line, length, lineNumber);
+        }
+    }
+    if (level.height > 0) {
+        addLevel(&level);
+    }
+    fclose(file);
+
+    if (levelCount == 0) {
+        fail(lineNumber, "no maps found");
+    }
+
+    printPack();
+    fprintf(stderr, "%d levels, %d bytes of data + %d bytes of offsets\n",
+            levelCount, packSize, levelCount * 2);
+    return 0;
+}
@@ -0,0 +1,483 @@
+/*
+ * maze_sim.c - Headless maze game: replay logs and run batches of games
+ *
+ * Host tool, not part of the firmware. Build and run from the project folder:
+ *
+ *   cc -O2 -I. -o maze_sim tools/maze_sim.c MazeGame.c InputLog.c EnemySet.c \
+ *       DistField.c MoveMask.c MazeGen.c LevelPack.c Levels.c HAL/Format.c
+ *   ./maze_sim replay <log file or ->
+ *   ./maze_sim batch <games> [maze size] [chase percent] [seed] [game to dump]
+ *   ./maze_sim check [games] [seed]
+ *
+ * replay reads a log sent by the LaunchPad (press 'l' after a game; other
+ * terminal text around it is skipped), plays the keys through the same
+ * MazeGame code and checks that the move count, end state and hash match.
+ *
+ * batch plays games with a bot that heads for the goal while keeping out of
+ * the enemies' reach, waiting by pressing into a wall when its way is
+ * blocked. It takes hunters to come straight for it and only keeps clear of
+ * the cells wanderers could step onto next. A maze size of 0 plays the
+ * level numbered by the seed (from 0) with its own enemies, like "Play Game";
+ * other sizes generate and braid a maze from the seed with 16 enemies, like
+ * the "Random Maze" menu item. Each game gets its own seed. The bot's win
+ * rate falls steadily as the chase percent rises, which is what tuning
+ * needs. It prints win/loss counts and games per second, and can print the
+ * log of one game so it can be fed back to replay.
+ *
+ * check plays "Random Maze" games, a new maze each, at every difficulty of
+ * the menu, and fails if the bot wins none of them at some difficulty.
+ */
+
+#include <InputLog.h>
+#include <LevelPack.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Same as RANDOM_MAZE_SIZE, RANDOM_MAZE_ENEMIES and RANDOM_MAZE_BRAID_PERCENT
+// in Application.h
+#define GENERATED_MAZE_SIZE 31
+#define GENERATED_MAZE_ENEMIES 16
+#define GENERATED_MAZE_BRAID_PERCENT 25
+// Bot games longer than this many keys per maze cell count as timeouts
+#define BOT_KEYS_PER_CELL 4
+
+static MazeStorage storage;
+static DistField pursuit;
+static DistField toGoal;
+static MoveMask moves;
+static InputLog log_;
+
+static const char* stateNames[] = { "running", "win", "caught" };
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static EnemySpawn spawns[MAZEGAME_MAX_SPAWNS];
+static int spawnCount;
+
+// Size 0 loads a level and its enemies; other sizes generate a maze and
+// braid it as "Random Maze" does
+static const Maze* buildMaze(int size, uint32_t seed) {
+    spawnCount = 0;
+    if (size != 0) {
+        MazeGen_generate(&storage, size, size, seed);
+        MazeGen_braid(&storage, GENERATED_MAZE_BRAID_PERCENT, seed);
+        return &storage.maze;
+    }
+    if (seed >= (uint32_t)Levels_count) {
+        fprintf(stderr, "no level %u; the pack has %d\n", seed, Levels_count);
+        exit(2);
+    }
+    return LevelPack_load(&storage, seed, spawns, &spawnCount);
+}
+
+// Set up a game the way the device does for this maze
+static void initGame(MazeGame* game_p, const Maze* maze_p, int size) {
+    MazeGame_init(game_p, maze_p, &pursuit, &moves, GENERATED_MAZE_ENEMIES);
+    if (size == 0) {
+        MazeGame_setSpawns(game_p, spawns, spawnCount);
+    }
+}
+
+static void printLog(const InputLog* log_p, const MazeGame* game_p) {
+    char line[INPUTLOG_LINE_MAX];
+    int i;
+
+    InputLog_formatHeader(line, log_p);
+    puts(line);
+    for (i = 0; i < log_p->count; i++) {
+        InputLog_formatEvent(line, &log_p->events[i]);
+        puts(line);
+    }
+    if (log_p->overflow) {
+        puts("TRUNCATED");
+    }
+    InputLog_formatEnd(line, game_p);
+    puts(line);
+}
+
+static int replay(const char* path) {
+    FILE* file = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    if (!file) {
+        perror(path);
+        return 2;
+    }
+
+    MazeGame game;
+    char line[256];
+    bool started = false;
+    bool truncated = false;
+    uint32_t lastTime = 0;
+    int keys = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+        unsigned size, mazeSeed, gameSeed, enemies, chase;
+        unsigned moves, state, hash, time_ms;
+        char key[8];
+
+        if (sscanf(line, "MAZELOG %u %u %u %u %u", &size, &mazeSeed, &gameSeed,
+                   &enemies, &chase) == 5) {
+            const Maze* maze_p = buildMaze(size, mazeSeed);
+            initGame(&game, maze_p, size);
+            if ((unsigned)game.enemyCount != enemies) {
+                printf("log has %u enemies but this maze gets %d\n", enemies,
+                       game.enemyCount);
+                return 1;
+            }
+            MazeGame_reset(&game, gameSeed, chase);
+            started = true;
+            keys = 0;
+        } else if (!started) {
+            continue;
+        } else if (strncmp(line, "TRUNCATED", 9) == 0) {
+            truncated = true;
+        } else if (sscanf(line, "END %u %u %x", &moves, &state, &hash) == 3) {
+            uint32_t got = MazeGame_hash(&game);
+            printf("%d keys over %.1f s: %d moves, %s, hash %08X\n", keys,
+                   lastTime / 1000.0, game.moveCount, stateNames[game.state], got);
+
+            if (truncated) {
+                printf("log was truncated on the device; end state not checked\n");
+                return 0;
+            }
+            if (moves != (unsigned)game.moveCount || state != (unsigned)game.state ||
+                hash != got) {
+                printf("MISMATCH: device ended with %u moves, %s, hash %08X\n",
+                       moves, state < 3 ? stateNames[state] : "?", hash);
+                return 1;
+            }
+            printf("replay matches the device\n");
+            return 0;
+        } else if (sscanf(line, "%u %7s", &time_ms, key) == 2) {
+            char c = key[0];
+            if (strncmp(key, "0x", 2) == 0) {
+                c = (char)strtoul(key + 2, NULL, 16);
+            }
+            MazeGame_step(&game, c);
+            lastTime = time_ms;
+            keys++;
+        }
+    }
+
+    fprintf(stderr, "%s: no complete MAZELOG found\n", path);
+    return 2;
+}
+
+// xorshift32 for the bot, kept apart from the game's own generator
+static uint32_t botRandom(uint32_t* state_p) {
+    uint32_t x = *state_p;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state_p = x;
+    return x;
+}
+
+// Turns until some hunter could stand on each cell, cells a wanderer could
+// step onto next turn, and the bot's own search through the cells it gets
+// to safely
+static uint16_t hunterTurns[DISTFIELD_MAX_CELLS];
+static uint8_t nearWanderer[DISTFIELD_MAX_CELLS];
+static uint16_t steps[DISTFIELD_MAX_CELLS];
+static uint8_t firstKey[DISTFIELD_MAX_CELLS];
+static uint16_t queue[DISTFIELD_MAX_CELLS];
+
+// Mark the cells within reach steps of cell
+static void markReach(int cell, int reach) {
+    nearWanderer[cell] = 1;
+    if (reach == 0) {
+        return;
+    }
+
+    uint8_t mask = MoveMask_at(&moves, cell);
+    int dir;
+    for (dir = MOVE_UP; dir <= MOVE_RIGHT; dir++) {
+        if ((mask >> dir) & 1) {
+            markReach(cell + moves.delta[dir], reach - 1);
+        }
+    }
+}
+
+// Hunters are taken to come straight for the bot. Wanderers rarely do, so
+// only the cells they could step onto next turn are kept clear; the bot
+// waits for them to move off its way. Hunters that never chase are
+// wanderers too.
+static void markEnemies(const MazeGame* game_p) {
+    const EnemySet* enemies_p = &game_p->enemies;
+    int cells = game_p->maze_p->width * game_p->maze_p->height;
+    int head = 0, tail = 0;
+    int i, dir;
+
+    for (i = 0; i < cells; i++) {
+        hunterTurns[i] = DISTFIELD_UNREACHED;
+        nearWanderer[i] = 0;
+    }
+    for (i = 0; i < enemies_p->count; i++) {
+        if (enemies_p->behavior[i] == ENEMY_HUNTER && game_p->chasePercent > 0) {
+            hunterTurns[enemies_p->cell[i]] = 0;
+            queue[tail++] = enemies_p->cell[i];
+        } else {
+            markReach(enemies_p->cell[i], enemies_p->speed[i]);
+        }
+    }
+
+    // Hunters move one step a turn
+    while (head < tail) {
+        int cell = queue[head++];
+        uint8_t mask = MoveMask_at(&moves, cell);
+        for (dir = MOVE_UP; dir <= MOVE_RIGHT; dir++) {
+            int next = cell + moves.delta[dir];
+            if (((mask >> dir) & 1) && hunterTurns[next] == DISTFIELD_UNREACHED) {
+                hunterTurns[next] = hunterTurns[cell] + 1;
+                queue[tail++] = next;
+            }
+        }
+    }
+}
+
+// Whether the bot, arriving on cell after the given number of keys, could
+// be caught there
+static bool isCovered(const MazeGame* game_p, int cell, int arrival) {
+    const Maze* maze_p = game_p->maze_p;
+    int goal = maze_p->goalY * maze_p->width + maze_p->goalX;
+
+    // Reaching the goal wins before the enemies move
+    if (cell == goal) {
+        return hunterTurns[cell] < arrival || EnemySet_isCellOccupied(&game_p->enemies, cell);
+    }
+    return hunterTurns[cell] <= arrival || nearWanderer[cell];
+}
+
+// Search from cell, where the bot stands after keysPressed keys, through the
+// cells it can reach safely. Returns how many there are; *key_p gets the
+// first key toward the one nearest the goal, or -1 if that is cell itself.
+static int claim(const MazeGame* game_p, int cell, int keysPressed, int* key_p) {
+    const Maze* maze_p = game_p->maze_p;
+    int cells = maze_p->width * maze_p->height;
+    uint16_t nearest = toGoal.dist[cell];
+    int head = 0, tail = 0;
+    int i, dir;
+
+    for (i = 0; i < cells; i++) {
+        steps[i] = DISTFIELD_UNREACHED;
+    }
+    steps[cell] = keysPressed;
+    firstKey[cell] = 4;
+    queue[tail++] = cell;
+    *key_p = -1;
+
+    while (head < tail) {
+        int from = queue[head++];
+        uint8_t mask = MoveMask_at(&moves, from);
+        for (dir = MOVE_UP; dir <= MOVE_RIGHT; dir++) {
+            int next = from + moves.delta[dir];
+            if (!((mask >> dir) & 1) || steps[next] != DISTFIELD_UNREACHED ||
+                isCovered(game_p, next, steps[from] + 1)) {
+                continue;
+            }
+            steps[next] = steps[from] + 1;
+            firstKey[next] = firstKey[from] == 4 ? dir : firstKey[from];
+            if (toGoal.dist[next] < nearest) {
+                nearest = toGoal.dist[next];
+                *key_p = firstKey[next];
+            }
+            queue[tail++] = next;
+        }
+    }
+    return tail;
+}
+
+// Pick the bot's next key. It heads for the cell nearest the goal that it
+// can reach safely, which is the goal itself once the way is clear. Already
+// there, it waits by pressing into a wall, or else moves wherever leaves it
+// the most cells it can still reach safely, which keeps it out of dead ends
+// that a hunter is closing. When every choice could get it caught it
+// presses a random key.
+static char botKey(const MazeGame* game_p, uint32_t* random_p) {
+    static const char keys[4] = { 'u', 'd', 'l', 'r' };
+    const Maze* maze_p = game_p->maze_p;
+    int cell = game_p->player_y * maze_p->width + game_p->player_x;
+    uint8_t mask = MoveMask_at(&moves, cell);
+    int best = -1;
+    int bestScore = 0;
+    int key, dir;
+
+    markEnemies(game_p);
+
+    claim(game_p, cell, 0, &key);
+    if (key >= 0) {
+        return keys[key];
+    }
+
+    // Waiting needs a wall to press into
+    if (mask != 0x0F && !isCovered(game_p, cell, 1)) {
+        for (dir = MOVE_UP; (mask >> dir) & 1; dir++) {
+        }
+        best = dir;
+        bestScore = claim(game_p, cell, 1, &key);
+    }
+
+    // Start at a random direction so ties don't always break the same way
+    int first = botRandom(random_p) % 4;
+    for (dir = 0; dir < 4; dir++) {
+        int d = (first + dir) % 4;
+        int next = cell + moves.delta[d];
+        if (!((mask >> d) & 1) || isCovered(game_p, next, 1)) {
+            continue;
+        }
+
+        int score = claim(game_p, next, 1, &key);
+        if (score > bestScore) {
+            best = d;
+            bestScore = score;
+        }
+    }
+
+    return keys[best >= 0 ? best : (int)(botRandom(random_p) % 4)];
+}
+
+// Point the bot at the goal of maze_p
+static void aimBot(const Maze* maze_p) {
+    DistField_init(&toGoal, maze_p);
+    DistField_setSource(&toGoal, maze_p->goalX, maze_p->goalY);
+    DistField_update(&toGoal, DISTFIELD_MAX_CELLS);
+}
+
+// Let the bot play one game from gameSeed, recording its keys if record is
+// set. Returns how many keys it pressed.
+static int playBot(MazeGame* game_p, uint32_t gameSeed, uint32_t chase, bool record) {
+    const Maze* maze_p = game_p->maze_p;
+    int maxKeys = BOT_KEYS_PER_CELL * maze_p->width * maze_p->height;
+    uint32_t botState = gameSeed | 1;
+    int keys = 0;
+
+    MazeGame_reset(game_p, gameSeed, chase);
+    while (game_p->state == GAME_RUNNING && keys < maxKeys) {
+        char key = botKey(game_p, &botState);
+        if (record) {
+            // The bot presses one key every 100 ms of pretend time
+            InputLog_record(&log_, keys * 100, key);
+        }
+        MazeGame_step(game_p, key);
+        keys++;
+    }
+    return keys;
+}
+
+static int batch(int games, int size, uint32_t chase, uint32_t seed, int dump) {
+    const Maze* maze_p = buildMaze(size, seed);
+    int results[3] = { 0, 0, 0 };
+    long long totalKeys = 0;
+    long long winMoves = 0;
+    MazeGame game;
+    int g;
+
+    aimBot(maze_p);
+    initGame(&game, maze_p, size);
+    int enemies = game.enemyCount;
+
+    double start = nowSeconds();
+    for (g = 0; g < games; g++) {
+        uint32_t gameSeed = seed ^ (uint32_t)(g + 1) * 2654435761u;
+
+        if (g == dump) {
+            InputLog_start(&log_, size, seed, gameSeed, enemies, chase);
+        }
+        int keys = playBot(&game, gameSeed, chase, g == dump);
+
+        results[game.state]++;
+        totalKeys += keys;
+        if (game.state == GAME_WIN) {
+            winMoves += game.moveCount;
+        }
+        if (g == dump) {
+            printLog(&log_, &game);
+        }
+    }
+    double elapsed = nowSeconds() - start;
+
+    fprintf(stderr, "%dx%d maze, %d enemies, chase %u%%: %d games\n",
+            maze_p->width, maze_p->height, enemies, chase, games);
+    fprintf(stderr, "  won %d, caught %d, timed out %d", results[GAME_WIN],
+            results[GAME_OVER], results[GAME_RUNNING]);
+    if (results[GAME_WIN] > 0) {
+        fprintf(stderr, ", %.1f moves per win", (double)winMoves / results[GAME_WIN]);
+    }
+    fprintf(stderr, "\n  %.3f s, %.0f games/s, %.2f M keys/s\n", elapsed,
+            games / elapsed, totalKeys / elapsed / 1e6);
+    return 0;
+}
+
+// Same as chaseChance in proj1_main.c: Random, Mixed and Chase
+static const uint32_t menuChase[] = { 0, 60, 90 };
+
+// Play "Random Maze" at every difficulty; fails if one is never won
+static int check(int games, uint32_t seed) {
+    int failed = 0;
+    int m, g;
+
+    for (m = 0; m < (int)(sizeof(menuChase) / sizeof(menuChase[0])); m++) {
+        int wins = 0;
+
+        for (g = 0; g < games; g++) {
+            uint32_t mazeSeed = seed + g;
+            const Maze* maze_p = buildMaze(GENERATED_MAZE_SIZE, mazeSeed);
+            MazeGame game;
+
+            aimBot(maze_p);
+            initGame(&game, maze_p, GENERATED_MAZE_SIZE);
+            playBot(&game, mazeSeed * 2654435761u, menuChase[m], false);
+            wins += game.state == GAME_WIN;
+        }
+
+        printf("chase %2u%%: won %d of %d random mazes\n", menuChase[m], wins, games);
+        if (wins == 0) {
+            failed = 1;
+        }
+    }
+
+    if (failed) {
+        fprintf(stderr, "some difficulty of Random Maze was never won\n");
+    }
+    return failed;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 3 && strcmp(argv[1], "replay") == 0) {
+        return replay(argv[2]);
+    }
+
+    if (argc >= 3 && strcmp(argv[1], "batch") == 0) {
+        int games = atoi(argv[2]);
+        int size = argc > 3 ? atoi(argv[3]) : 31;
+        int chase = argc > 4 ? atoi(argv[4]) : 60;
+        uint32_t seed = argc > 5 ? (uint32_t)strtoul(argv[5], NULL, 0) : 1;
+        int dump = argc > 6 ? atoi(argv[6]) : -1;
+        if (chase < 0 || chase > 100) {
+            fprintf(stderr, "chase percent %d is not between 0 and 100\n", chase);
+            return 2;
+        }
+        return batch(games, size, (uint32_t)chase, seed, dump);
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "check") == 0) {
+        int games = argc > 2 ? atoi(argv[2]) : 100;
+        uint32_t seed = argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 0) : 1;
+        if (games <= 0) {
+            fprintf(stderr, "need at least one game, not %d\n", games);
+            return 2;
+        }
+        return check(games, seed);
+    }
+
+    fprintf(stderr, "usage: %s replay <log file or ->\n"
+                    "       %s batch <games> [maze size] [chase percent] [seed] [game to dump]\n"
+                    "       %s check [games] [seed]\n",
+            argv[0], argv[0], argv[0]);
+    return 2;
+}
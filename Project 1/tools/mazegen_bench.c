@@ -0,0 +1,101 @@
+/*
+ * mazegen_bench.c - Host benchmark for the maze generator
+ *
+ * Host tool, not part of the firmware. Build and run from the project folder:
+ *
+ *   cc -O2 -I. -o mazegen_bench tools/mazegen_bench.c MazeGen.c
+ *   ./mazegen_bench [mazes per size]
+ *
+ * For each size it reports the average generation time, the bytes the maze
+ * itself needs, and checks that every room is reachable from the start and
+ * that the goal is, which is what a perfect maze guarantees.
+ */
+
+#include <MazeGen.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Flood fill from the start; returns the number of open cells reached
+static int reachable(const Maze* maze_p, int* goalReached) {
+    static uint16_t queue[MAZE_GEN_MAX * MAZE_GEN_MAX];
+    static uint8_t seen[MAZE_GEN_MAX * MAZE_GEN_MAX];
+    int head = 0, tail = 0;
+
+    memset(seen, 0, sizeof(seen));
+    queue[tail++] = maze_p->startY * maze_p->width + maze_p->startX;
+    seen[queue[0]] = 1;
+
+    while (head < tail) {
+        int cell = queue[head++];
+        int x = cell % maze_p->width, y = cell / maze_p->width;
+        static const int dx[4] = { 0, 0, -1, 1 }, dy[4] = { -1, 1, 0, 0 };
+        int d;
+        for (d = 0; d < 4; d++) {
+            int nx = x + dx[d], ny = y + dy[d];
+            int next = ny * maze_p->width + nx;
+            if (!Maze_isWall(maze_p, nx, ny) && !seen[next]) {
+                seen[next] = 1;
+                queue[tail++] = next;
+            }
+        }
+    }
+
+    *goalReached = seen[maze_p->goalY * maze_p->width + maze_p->goalX];
+    return tail;
+}
+
+static int openCells(const Maze* maze_p) {
+    int x, y, count = 0;
+    for (y = 0; y < maze_p->height; y++) {
+        for (x = 0; x < maze_p->width; x++) {
+            count += !Maze_isWall(maze_p, x, y);
+        }
+    }
+    return count;
+}
+
+int main(int argc, char** argv) {
+    static const int sizes[] = { 11, 16, 21, 32, 48, 63, 64 };
+    int runs = argc > 1 ? atoi(argv[1]) : 2000;
+    static MazeStorage storage;
+    int failures = 0;
+    size_t i;
+
+    printf("size   us/maze   maze bytes   scratch bytes\n");
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        int size = sizes[i];
+        int r;
+
+        double start = nowSeconds();
+        for (r = 0; r < runs; r++) {
+            MazeGen_generate(&storage, size, size, r + 1);
+        }
+        double elapsed = nowSeconds() - start;
+
+        // Check a handful of seeds for connectivity
+        for (r = 0; r < 50; r++) {
+            const Maze* maze_p = MazeGen_generate(&storage, size, size, 1000 + r);
+            int goal;
+            if (reachable(maze_p, &goal) != openCells(maze_p) || !goal) {
+                printf("size %d seed %d is not a perfect maze\n", size, 1000 + r);
+                failures++;
+            }
+        }
+
+        int mazeBytes = size * MAZE_ROW_WORDS(size) * 4 + (int)sizeof(Maze);
+        printf("%2dx%-2d  %8.2f   %10d   %13d\n", size, size, elapsed / runs * 1e6,
+               mazeBytes, MAZE_GEN_SCRATCH_BYTES);
+    }
+
+    printf("MazeStorage is %d bytes for up to %dx%d\n", (int)sizeof(MazeStorage),
+           MAZE_GEN_MAX, MAZE_GEN_MAX);
+    return failures ? 1 : 0;
+}
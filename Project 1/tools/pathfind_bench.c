@@ -0,0 +1,472 @@
+/*
+ * pathfind_bench.c - Host benchmark of maze path searches
+ *
+ * Host tool, not part of the firmware. Build and run from the project folder:
+ *
+ *   cc -O2 -I. -o pathfind_bench tools/pathfind_bench.c MazeGen.c DistField.c
+ *   ./pathfind_bench [queries per maze] > pathfind.csv
+ *
+ * Mazes come from MazeGen at sizes 15 to 63. Each one is also "braided":
+ * a share of the walls between two corridors is knocked out, which adds
+ * loops and open space. Every maze is searched between the same random pairs
+ * of open cells (an enemy and the player) with:
+ *
+ *   bfs       breadth-first search, stopping at the target
+ *   astar     A* with the Manhattan distance, binary heap open list
+ *   jps       jump point search for 4-connected grids on top of the A* heap
+ *   distfield one full DistField rebuild, as the game does: one search
+ *             from the player serves every enemy, so it is timed per rebuild
+ *
+ * Each CSV row gives the time per query, the nodes taken off the queue or
+ * heap, the path length (checked to match between bfs, astar and jps), and
+ * the peak bytes of working memory with 16-bit cell indices and distances,
+ * as the MSP432 build would use them. Timings are host times; the ratios
+ * between algorithms are what carries over to the 48 MHz Cortex-M4.
+ */
+
+#include <DistField.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_CELLS (MAZE_GEN_MAX * MAZE_GEN_MAX)
+#define NO_PATH 0xFFFF
+
+static const int8_t stepX[4] = { 0, 0, -1, 1 };
+static const int8_t stepY[4] = { -1, 1, 0, 0 };
+
+static const int sizes[] = { 15, 31, 47, 63 };
+static const int braidPercents[] = { 0, 10, 30, 60 };
+
+static MazeStorage storage;
+static DistField field;
+
+// Working memory shared by the searches
+static uint16_t queue[MAX_CELLS];
+static uint16_t dist[MAX_CELLS];
+static uint32_t seen[MAX_CELLS / 32];
+static uint32_t closed[MAX_CELLS / 32];
+
+typedef struct {
+    uint16_t cell;
+    uint16_t f;
+} HeapEntry;
+
+static HeapEntry heap[4 * MAX_CELLS];
+static int heapSize;
+static int heapPeak;
+
+// Counters for one query
+static long expanded;
+static int dynamicPeak;
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t rngState = 12345;
+
+static uint32_t nextRandom(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static inline bool testBit(const uint32_t* bits, int i) {
+    return (bits[i >> 5] >> (i & 31)) & 1;
+}
+
+static inline void setBit(uint32_t* bits, int i) {
+    bits[i >> 5] |= 1u << (i & 31);
+}
+
+static void clearBits(uint32_t* bits, int cells) {
+    memset(bits, 0, ((cells + 31) / 32) * sizeof(uint32_t));
+}
+
+// Knock out percent of the walls that sit between two open cells in a line
+static void braid(Maze* maze_p, int percent) {
+    uint32_t* walls = (uint32_t*)maze_p->walls;
+    int x, y;
+
+    for (y = 1; y < maze_p->height - 1; y++) {
+        for (x = 1; x < maze_p->width - 1; x++) {
+            if (!Maze_isWall(maze_p, x, y)) {
+                continue;
+            }
+            bool horizontal = !Maze_isWall(maze_p, x - 1, y) && !Maze_isWall(maze_p, x + 1, y);
+            bool vertical = !Maze_isWall(maze_p, x, y - 1) && !Maze_isWall(maze_p, x, y + 1);
+            if ((horizontal || vertical) && (int)(nextRandom() % 100) < percent) {
+                walls[y * maze_p->rowWords + (x >> 5)] &= ~(1u << (x & 31));
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------- BFS
+
+static int bfs(const Maze* maze_p, int from, int to) {
+    int width = maze_p->width;
+    int head = 0, tail = 0;
+
+    clearBits(seen, width * maze_p->height);
+    setBit(seen, from);
+    dist[from] = 0;
+    queue[tail++] = from;
+
+    while (head < tail) {
+        int cell = queue[head++];
+        expanded++;
+        if (cell == to) {
+            dynamicPeak = tail;
+            return dist[cell];
+        }
+
+        int x = cell % width;
+        int y = cell / width;
+        int d;
+        for (d = 0; d < 4; d++) {
+            int nx = x + stepX[d];
+            int ny = y + stepY[d];
+            int next = ny * width + nx;
+            if (!Maze_isWall(maze_p, nx, ny) && !testBit(seen, next)) {
+                setBit(seen, next);
+                dist[next] = dist[cell] + 1;
+                queue[tail++] = next;
+            }
+        }
+    }
+
+    dynamicPeak = tail;
+    return NO_PATH;
+}
+
+// ---------------------------------------------------------------- heap
+
+static void heapPush(int cell, int f) {
+    int i = heapSize++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (heap[parent].f <= f) {
+            break;
+        }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i].cell = cell;
+    heap[i].f = f;
+    if (heapSize > heapPeak) {
+        heapPeak = heapSize;
+    }
+}
+
+static int heapPop(void) {
+    int top = heap[0].cell;
+    HeapEntry last = heap[--heapSize];
+    int i = 0;
+
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= heapSize) {
+            break;
+        }
+        if (child + 1 < heapSize && heap[child + 1].f < heap[child].f) {
+            child++;
+        }
+        if (heap[child].f >= last.f) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = last;
+    return top;
+}
+
+static inline int manhattan(int width, int a, int b) {
+    return abs(a % width - b % width) + abs(a / width - b / width);
+}
+
+// ---------------------------------------------------------------- A*
+
+static int astar(const Maze* maze_p, int from, int to) {
+    int width = maze_p->width;
+    int cells = width * maze_p->height;
+
+    // seen marks cells with a valid g in dist; closed marks finished cells
+    clearBits(seen, cells);
+    clearBits(closed, cells);
+    heapSize = 0;
+    heapPeak = 0;
+
+    dist[from] = 0;
+    setBit(seen, from);
+    heapPush(from, manhattan(width, from, to));
+
+    while (heapSize > 0) {
+        int cell = heapPop();
+        if (testBit(closed, cell)) {
+            continue;  // stale entry, a shorter one was already taken
+        }
+        setBit(closed, cell);
+        expanded++;
+        if (cell == to) {
+            dynamicPeak = heapPeak;
+            return dist[cell];
+        }
+
+        int x = cell % width;
+        int y = cell / width;
+        int d;
+        for (d = 0; d < 4; d++) {
+            int nx = x + stepX[d];
+            int ny = y + stepY[d];
+            if (Maze_isWall(maze_p, nx, ny)) {
+                continue;
+            }
+            int next = ny * width + nx;
+            int g = dist[cell] + 1;
+            if (!testBit(seen, next) || g < dist[next]) {
+                setBit(seen, next);
+                dist[next] = g;
+                heapPush(next, g + manhattan(width, next, to));
+            }
+        }
+    }
+
+    dynamicPeak = heapPeak;
+    return NO_PATH;
+}
+
+// ---------------------------------------------------------------- JPS
+//
+// Canonical paths go vertical first and turn horizontal anywhere; a
+// horizontal run turns vertical only where it has to (a forced neighbor:
+// the cell above or below opens up while the one behind it was a wall).
+// So a vertical jump stops where a horizontal jump from it finds something,
+// and a horizontal jump stops at forced neighbors.
+
+static const Maze* jpsMaze;
+static int jpsTarget;
+
+static inline bool open(int x, int y) {
+    return !Maze_isWall(jpsMaze, x, y);
+}
+
+// Run horizontally from (x, y); returns the jump point cell or -1
+static int jumpH(int x, int y, int dx) {
+    int width = jpsMaze->width;
+    while (true) {
+        x += dx;
+        if (!open(x, y)) {
+            return -1;
+        }
+        int cell = y * width + x;
+        if (cell == jpsTarget) {
+            return cell;
+        }
+        if ((open(x, y - 1) && !open(x - dx, y - 1)) ||
+            (open(x, y + 1) && !open(x - dx, y + 1))) {
+            return cell;
+        }
+    }
+}
+
+// Run vertically from (x, y); returns the jump point cell or -1
+static int jumpV(int x, int y, int dy) {
+    int width = jpsMaze->width;
+    while (true) {
+        y += dy;
+        if (!open(x, y)) {
+            return -1;
+        }
+        int cell = y * width + x;
+        if (cell == jpsTarget || jumpH(x, y, -1) >= 0 || jumpH(x, y, 1) >= 0) {
+            return cell;
+        }
+    }
+}
+
+// Direction each node was reached in, 0-3 as stepX/stepY, 4 for the start
+static uint8_t arrivedBy[MAX_CELLS];
+
+static void jpsPush(int cell, int g, int dir) {
+    int width = jpsMaze->width;
+    if (!testBit(seen, cell) || g < dist[cell]) {
+        setBit(seen, cell);
+        dist[cell] = g;
+        arrivedBy[cell] = dir;
+        heapPush(cell, g + manhattan(width, cell, jpsTarget));
+    }
+}
+
+static void jpsTry(int cell, int jump, int dir) {
+    if (jump >= 0) {
+        jpsPush(jump, dist[cell] + manhattan(jpsMaze->width, cell, jump), dir);
+    }
+}
+
+static int jps(const Maze* maze_p, int from, int to) {
+    int width = maze_p->width;
+    int cells = width * maze_p->height;
+
+    jpsMaze = maze_p;
+    jpsTarget = to;
+    clearBits(seen, cells);
+    clearBits(closed, cells);
+    heapSize = 0;
+    heapPeak = 0;
+
+    dist[from] = 0;
+    setBit(seen, from);
+    arrivedBy[from] = 4;
+    heapPush(from, manhattan(width, from, to));
+
+    while (heapSize > 0) {
+        int cell = heapPop();
+        if (testBit(closed, cell)) {
+            continue;
+        }
+        setBit(closed, cell);
+        expanded++;
+        if (cell == to) {
+            dynamicPeak = heapPeak;
+            return dist[cell];
+        }
+
+        int x = cell % width;
+        int y = cell / width;
+        int dir = arrivedBy[cell];
+
+        if (dir == 4 || dir == 0 || dir == 1) {
+            // Start or vertical: keep going vertically, branch both ways
+            if (dir != 1) jpsTry(cell, jumpV(x, y, -1), 0);
+            if (dir != 0) jpsTry(cell, jumpV(x, y, 1), 1);
+            jpsTry(cell, jumpH(x, y, -1), 2);
+            jpsTry(cell, jumpH(x, y, 1), 3);
+        } else {
+            // Horizontal: keep going, and turn where a neighbor is forced
+            int dx = stepX[dir];
+            jpsTry(cell, jumpH(x, y, dx), dir);
+            if (open(x, y - 1) && !open(x - dx, y - 1)) jpsTry(cell, jumpV(x, y, -1), 0);
+            if (open(x, y + 1) && !open(x - dx, y + 1)) jpsTry(cell, jumpV(x, y, 1), 1);
+        }
+    }
+
+    dynamicPeak = heapPeak;
+    return NO_PATH;
+}
+
+// ---------------------------------------------------------------- harness
+
+typedef int (*Search)(const Maze* maze_p, int from, int to);
+
+// Fixed arrays plus the measured peak of the queue or heap, in MSP432 sizes
+static long bytesFor(const char* name, int cells, int peak) {
+    long bits = (cells + 31) / 32 * 4;
+    if (strcmp(name, "bfs") == 0) {
+        return bits + 2L * cells + 2L * peak;            // seen, dist, queue
+    }
+    if (strcmp(name, "astar") == 0) {
+        return 2 * bits + 2L * cells + 4L * peak;        // seen, closed, g, heap
+    }
+    return 2 * bits + 2L * cells + cells / 4 + 4L * peak; // + 2-bit direction
+}
+
+static void pickPairs(const Maze* maze_p, int queries, int* from, int* to) {
+    int width = maze_p->width;
+    int i;
+    for (i = 0; i < queries; i++) {
+        int a, b;
+        do {
+            a = nextRandom() % (width * maze_p->height);
+        } while (Maze_isWall(maze_p, a % width, a / width));
+        do {
+            b = nextRandom() % (width * maze_p->height);
+        } while (Maze_isWall(maze_p, b % width, b / width));
+        from[i] = a;
+        to[i] = b;
+    }
+}
+
+int main(int argc, char** argv) {
+    int queries = argc > 1 ? atoi(argv[1]) : 2000;
+    if (queries <= 0) {
+        // Every row averages over the queries, and the rebuilds start from them
+        fprintf(stderr, "need at least one query per maze, not %d\n", queries);
+        return 2;
+    }
+    int* from = malloc(queries * sizeof(int));
+    int* to = malloc(queries * sizeof(int));
+    uint16_t* lengths = malloc(queries * sizeof(uint16_t));
+    const char* names[] = { "bfs", "astar", "jps" };
+    Search searches[] = { bfs, astar, jps };
+    int s, b, a, i;
+    int mismatches = 0;
+
+    printf("size,braid_pct,open_cells,algorithm,queries,ns_per_query,"
+           "avg_expanded,avg_path,peak_bytes\n");
+
+    for (s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++) {
+        for (b = 0; b < (int)(sizeof(braidPercents) / sizeof(braidPercents[0])); b++) {
+            Maze* maze_p = (Maze*)MazeGen_generate(&storage, sizes[s], sizes[s], 1000 + s);
+            braid(maze_p, braidPercents[b]);
+
+            int cells = maze_p->width * maze_p->height;
+            int openCells = 0;
+            for (i = 0; i < cells; i++) {
+                openCells += !Maze_isWall(maze_p, i % maze_p->width, i / maze_p->width);
+            }
+            pickPairs(maze_p, queries, from, to);
+
+            for (a = 0; a < 3; a++) {
+                long totalPath = 0;
+                int peak = 0;
+
+                expanded = 0;
+                double start = nowSeconds();
+                for (i = 0; i < queries; i++) {
+                    int length = searches[a](maze_p, from[i], to[i]);
+                    if (dynamicPeak > peak) {
+                        peak = dynamicPeak;
+                    }
+                    if (a == 0) {
+                        lengths[i] = length;
+                    } else if (length != lengths[i]) {
+                        mismatches++;
+                    }
+                    totalPath += length;
+                }
+                double elapsed = nowSeconds() - start;
+
+                printf("%d,%d,%d,%s,%d,%.0f,%.1f,%.1f,%ld\n", sizes[s], braidPercents[b],
+                       openCells, names[a], queries, elapsed * 1e9 / queries,
+                       (double)expanded / queries, (double)totalPath / queries,
+                       bytesFor(names[a], cells, peak));
+            }
+
+            // The game's way: one full field per player move serves all enemies
+            int rebuilds = queries / 10 + 1;
+            DistField_init(&field, maze_p);
+            double start = nowSeconds();
+            for (i = 0; i < rebuilds; i++) {
+                DistField_restart(&field, from[i] % maze_p->width, from[i] / maze_p->width);
+                DistField_update(&field, DISTFIELD_MAX_CELLS);
+            }
+            double elapsed = nowSeconds() - start;
+            printf("%d,%d,%d,distfield,%d,%.0f,%d,,%ld\n", sizes[s], braidPercents[b],
+                   openCells, rebuilds, elapsed * 1e9 / rebuilds, openCells,
+                   (long)((cells + 31) / 32 * 4 + 4L * cells));
+        }
+    }
+
+    if (mismatches) {
+        fprintf(stderr, "%d queries found different path lengths\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
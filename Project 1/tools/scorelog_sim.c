@@ -0,0 +1,223 @@
+/*
+ * scorelog_sim.c - Power-loss test of the flash high-score log
+ *
+ * Host tool, not part of the firmware. Build and run from the project folder:
+ *
+ *   cc -O2 -I. -o scorelog_sim tools/scorelog_sim.c ScoreLog.c
+ *   ./scorelog_sim [scores] [seed]
+ *
+ * Links ScoreLog.c against a simulated pair of flash sectors in place of
+ * HAL/ScoreFlash.c. Erased bytes read 0xFF and programming can only clear
+ * bits, as on the MSP432. The same list of scores is saved over and over,
+ * and each run cuts the power one flash step later than the last. A step
+ * is one programmed byte or one erase. The byte being written at the cut
+ * gets a random subset of its bits. A sector being erased gets random
+ * bits set.
+ *
+ * After each cut the log is opened again. The table must equal the table
+ * from before the interrupted save or the one after it, and saving the
+ * rest of the list must still give the right table. A final run without
+ * cuts reports how many erases each sector took.
+ */
+
+#include <ScoreLog.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t flash[SCOREFLASH_SECTORS][SCOREFLASH_SECTOR_SIZE];
+static long erases[SCOREFLASH_SECTORS];
+static long programmed;
+
+// Flash steps left before the power goes; negative means no cut
+static long budget = -1;
+static jmp_buf powerLoss;
+
+static uint32_t randomState = 1;
+
+static uint32_t nextRandom(void) {
+    uint32_t x = randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    randomState = x;
+    return x;
+}
+
+// Count one flash step; true if the power goes during it
+static bool cutNow(void) {
+    if (budget < 0) {
+        return false;
+    }
+    return budget-- == 0;
+}
+
+const uint8_t* ScoreFlash_sector(int index) {
+    return flash[index];
+}
+
+bool ScoreFlash_erase(int index) {
+    int i;
+
+    if (cutNow()) {
+        for (i = 0; i < SCOREFLASH_SECTOR_SIZE; i++) {
+            flash[index][i] |= (uint8_t)nextRandom();
+        }
+        longjmp(powerLoss, 1);
+    }
+
+    memset(flash[index], 0xFF, SCOREFLASH_SECTOR_SIZE);
+    erases[index]++;
+    return true;
+}
+
+bool ScoreFlash_program(int index, int offset, const void* data, int length) {
+    const uint8_t* bytes = data;
+    int i;
+
+    for (i = 0; i < length; i++) {
+        uint8_t* cell_p = &flash[index][offset + i];
+
+        if (cutNow()) {
+            // Some of the bits that should clear have cleared
+            *cell_p &= bytes[i] | (uint8_t)nextRandom();
+            longjmp(powerLoss, 1);
+        }
+        *cell_p &= bytes[i];
+        programmed++;
+    }
+    return true;
+}
+
+// The table a perfect store would hold: insertion into a sorted list
+typedef struct {
+    int32_t best[SCORELOG_TABLE_SIZE];
+    int count;
+} Table;
+
+static void tableAdd(Table* table_p, int32_t score) {
+    int i = table_p->count;
+
+    if (i == SCORELOG_TABLE_SIZE) {
+        if (score >= table_p->best[i - 1]) {
+            return;
+        }
+        i--;
+    } else {
+        table_p->count++;
+    }
+    while (i > 0 && score < table_p->best[i - 1]) {
+        table_p->best[i] = table_p->best[i - 1];
+        i--;
+    }
+    table_p->best[i] = score;
+}
+
+static bool sameTable(const ScoreLog* log_p, const Table* table_p) {
+    return log_p->count == table_p->count &&
+           memcmp(log_p->best, table_p->best, table_p->count * sizeof(int32_t)) == 0;
+}
+
+static int32_t* scores;
+static int scoreCount;
+
+// Kept out of main's locals, which longjmp may not preserve
+static ScoreLog log_;
+static int saved;
+
+// Save the scores from index first on, checking the table after each
+static bool saveFrom(ScoreLog* log_p, Table* table_p, int first, int* saved_p) {
+    int i;
+
+    for (i = first; i < scoreCount; i++) {
+        *saved_p = i;
+        ScoreLog_add(log_p, scores[i]);
+        tableAdd(table_p, scores[i]);
+        if (!sameTable(log_p, table_p)) {
+            return false;
+        }
+    }
+    *saved_p = scoreCount;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    scoreCount = argc > 1 ? atoi(argv[1]) : 1200;
+    randomState = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 1;
+    if (randomState == 0) {
+        randomState = 1;
+    }
+
+    // Mostly improving scores, so nearly every one is appended and the
+    // sectors fill and compact several times
+    int i;
+    scores = malloc(scoreCount * sizeof(int32_t));
+    for (i = 0; i < scoreCount; i++) {
+        scores[i] = 100000 - i * 4 + (int32_t)(nextRandom() % 64);
+    }
+
+    // A clean run gives the number of flash steps to try cutting at
+    Table table = { { 0 }, 0 };
+    memset(flash, 0xFF, sizeof(flash));
+    ScoreLog_open(&log_, true);
+    if (!saveFrom(&log_, &table, 0, &saved)) {
+        printf("FAIL: wrong table after score %d with no power loss\n", saved);
+        return 1;
+    }
+    long steps = programmed + erases[0] + erases[1];
+    printf("%d scores: %ld bytes programmed, erases per sector %ld / %ld\n",
+           scoreCount, programmed, erases[0], erases[1]);
+
+    long cut;
+    int failures = 0;
+    for (cut = 0; cut < steps; cut++) {
+        Table before = { { 0 }, 0 };
+        Table after;
+        int torn = 0;
+
+        memset(flash, 0xFF, sizeof(flash));
+        budget = cut;
+        ScoreLog_open(&log_, true);
+
+        if (setjmp(powerLoss) == 0) {
+            saveFrom(&log_, &before, 0, &saved);
+            printf("FAIL: cut %ld never happened\n", cut);
+            return 1;
+        }
+
+        // The save that was cut is in before already; rebuild the table
+        // from just ahead of it
+        torn = saved;
+        before.count = 0;
+        for (i = 0; i < torn; i++) {
+            tableAdd(&before, scores[i]);
+        }
+        after = before;
+        tableAdd(&after, scores[torn]);
+
+        budget = -1;
+        ScoreLog_open(&log_, true);
+        Table* kept = NULL;
+        if (sameTable(&log_, &before)) {
+            kept = &before;
+        } else if (sameTable(&log_, &after)) {
+            kept = &after;
+        } else {
+            printf("FAIL: cut %ld during score %d left a table matching neither side\n",
+                   cut, torn);
+            failures++;
+            continue;
+        }
+
+        // Power back on: the rest of the scores must still save correctly
+        if (!saveFrom(&log_, kept, torn + 1, &saved) ||
+            (ScoreLog_open(&log_, true), !sameTable(&log_, kept))) {
+            printf("FAIL: after cut %ld, wrong table at score %d\n", cut, saved);
+            failures++;
+        }
+    }
+
+    printf("%ld power cuts tried, %d failures\n", steps, failures);
+    return failures ? 1 : 0;
+}
@@ -3,6 +3,13 @@
 
 #include <HAL/HAL.h>
 #include <HAL/Graphics.h>
+#include <HAL/Random.h>
+#include <Difficulty.h>
+#include <Floor.h>
+#include <Parallax.h>
+#include <Physics.h>
+#include <ScoreLog.h>
+#include <Sprites.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
@@ -17,12 +24,6 @@ typedef enum {
     STATE_GAMEOVER
 } AppState;
 
-typedef enum {
-    JUMP_NONE,
-    JUMP_UP,
-    JUMP_DOWN
-} JumpState;
-
 typedef enum {
     CURSOR_0 = 0,
     CURSOR_1 = 1,
@@ -30,58 +31,75 @@ typedef enum {
     CURSOR_3 = 3
 } Cursor;
 
+// 24-bit colors, like FloorSegment.color
 typedef struct {
-    int center;
-    int up;
-    int down;
-    int left;
-    int right;
+    uint32_t center;
+    uint32_t up;
+    uint32_t down;
+    uint32_t left;
+    uint32_t right;
 } ColorWheel;
 
-typedef struct {
-    int x;
-    int width;
-    int color;
-} FloorSegment;
+// Random streams of the boot seed, one per subsystem that draws numbers
+typedef enum {
+    RANDOM_STREAM_FLOOR,
+    RANDOM_STREAM_COLORS
+} RandomStream;
+
+// What floorShown holds for a column: the index of its color in the wheel's
+// color list, FLOOR_SHOWN_GAP for a gap, or FLOOR_UNDRAWN if it must be
+// repainted, which no segment matches
+#define FLOOR_SHOWN_GAP DIFFICULTY_MAX_COLORS
+#define FLOOR_UNDRAWN 0xFF
 
 typedef struct {
     AppState state;
     bool titleScreenShown;
     bool screenNeedsRedraw;
     Cursor arrow;
-    bool joystickCentered;
 
     SWTimer titleTimer;
-    SWTimer jumpTimer;
     SWTimer scoreTimer;
     SWTimer floorTimer;
-    SWTimer fallTimer;
+    SWTimer physicsTimer;
 
-    int playerY;
-    JumpState jumpState;
-    int jumpProgress;
-    bool isOnGround;
-    int lastPlayerY;
+    Physics playerPhysics;
+    int playerY; // The row the player is drawn at.
 
     ColorWheel colorWheel;
 
+    Random floorRandom; // Segment widths and gaps.
+    Random colorRandom; // Segment colors.
+
     int score;
     int *highScores;
-    int jumpHeight;
     int playerRadius;
     int playerCenterX;
-    int playerJumpDelay;
     int maxHighScores;
 
     bool isFalling;
 
-    FloorSegment floorSegments[5];
-    int numFloorSegments;
+    Floor floor;
+    DifficultyPoint floorParams; // The difficulty curve at the current score.
+    Fix16 scrollFraction; // Scroll owed to the next tick, below a pixel.
+    // What the floor band shows now, one color index per column, and the
+    // scroll it was drawn at.
+    uint8_t floorShown[FLOOR_VIEW_WIDTH];
+    int32_t floorShownScroll;
+    bool floorDirty;
+
+    Parallax parallax;
+
+    // The game screen's moving parts, repainted by the sprite layer.
+    Sprites sprites;
+    Sprite wheelSprite;
+    Sprite playerSprite;
+    Sprite scoreSprite;
 
-    int difficulty;
+    int difficulty; // Index into difficultyModes.
 } Application;
 
-Application Application_construct();
+void Application_init(Application* app, uint32_t seed);
 void Application_loop(Application* app, HAL* hal);
 
 void App_Screen_showmainmenu(Application* app, GFX* gfx);
@@ -97,19 +115,22 @@ void App_Screen_showGameScreen(Application* app, GFX* gfx);
 void App_Screen_showOptionsScreen(Application* app, GFX* gfx);
 
 void resetSimpleGame(Application* app, HAL* hal, GFX* gfx);
+void loadHighScores(Application* app);
 
-void drawColorWheel(GFX* gfx, ColorWheel* cw);
+void drawColorWheel(Application* app);
 void updateColorWheel(Application* app, HAL* hal);
 void updateScore(Application* app, HAL* hal);
 void endGame(Application* app, HAL* hal);
 
-void drawPlayer(Application* app, GFX* gfx, int y, int ignoredColor);
+void initSprites(Application* app);
 void updateCharacter(Application* app, HAL* hal);
 
 void initFloor(Application* app);
+void generateFloor(Application* app);
 void updateFloor(Application* app);
-void drawFloor(Application* app, GFX* gfx);
-uint32_t getRandomColor(ColorWheel* wheel);
+void drawFloor(Application* app);
+void invalidateFloor(Application* app, int x1, int x2);
+uint32_t getRandomColor(Random* random_p, int colorCount);
 void App_Screen_handleGameOver(Application* app, HAL* hal);
 void checkPlayerFloorCollision(Application* app_p);
 void handleFalling(Application* app, HAL* hal);
@@ -0,0 +1,61 @@
+// Difficulty.c - Difficulty modes as tables of score and floor parameters
+
+#include <Difficulty.h>
+
+#define COUNT(table) ((int)(sizeof(table) / sizeof((table)[0])))
+
+// A steady pace with every color
+static const DifficultyPoint easyCurve[] = {
+    // score, speed, segment widths, colors, gap %
+    {0, FIX16_ONE, 40, 125, 5, 25},
+};
+
+// Twice the pace, and three points a second to match
+static const DifficultyPoint hardCurve[] = {
+    {0, 2 * FIX16_ONE, 40, 125, 5, 25},
+};
+
+// Starts gentle with three colors and long segments, and reaches the
+// full palette, short segments and four times the pace by 75 points
+static const DifficultyPoint increaseCurve[] = {
+    {0, FIX16_ONE, 60, 125, 3, 15},
+    {25, 2 * FIX16_ONE, 50, 115, 4, 20},
+    {75, 4 * FIX16_ONE, 40, 100, 5, 30},
+};
+
+const DifficultyMode difficultyModes[] = {
+    {"Easy", 1, easyCurve, COUNT(easyCurve)},
+    {"Hard", 3, hardCurve, COUNT(hardCurve)},
+    {"Increase", 1, increaseCurve, COUNT(increaseCurve)},
+};
+
+const int difficultyModeCount = COUNT(difficultyModes);
+
+// a + (b - a) * t, with t a Q16.16 fraction
+static int32_t lerp(int32_t a, int32_t b, Fix16 t) {
+  return a + (int32_t)(((int64_t)(b - a) * t) >> 16);
+}
+
+// Find the two points around score and blend them by how far between
+// them score is
+DifficultyPoint Difficulty_at(const DifficultyMode* mode_p, int score) {
+  const DifficultyPoint* points = mode_p->points;
+  int i = 0;
+
+  while (i + 1 < mode_p->pointCount && points[i + 1].score <= score) {
+    i++;
+  }
+
+  DifficultyPoint at = points[i];
+  if (i + 1 < mode_p->pointCount && score > points[i].score) {
+    const DifficultyPoint* next = &points[i + 1];
+    Fix16 t = (Fix16)(((int64_t)(score - at.score) << 16) / (next->score - at.score));
+    at.scrollSpeed = lerp(at.scrollSpeed, next->scrollSpeed, t);
+    at.segmentMin = lerp(at.segmentMin, next->segmentMin, t);
+    at.segmentMax = lerp(at.segmentMax, next->segmentMax, t);
+    at.colorCount = lerp(at.colorCount, next->colorCount, t);
+    at.gapPercent = lerp(at.gapPercent, next->gapPercent, t);
+  }
+  at.score = score;
+  return at;
+}
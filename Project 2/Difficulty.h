@@ -0,0 +1,49 @@
+// Difficulty.h - Difficulty modes as tables of score and floor parameters
+//
+// A mode is a curve: a const table of points, each giving the floor's
+// scroll speed, segment widths, number of colors and gap chance at a
+// score. Between two points every value is interpolated linearly, and past
+// the last point the last values hold. The game asks for the values at
+// the current score on every floor tick, so a curve ramps smoothly instead
+// of jumping in steps. A new mode is a new table and a row in
+// difficultyModes; tools/difficulty_check.c checks every curve against the
+// frame budget.
+
+#ifndef DIFFICULTY_H_
+#define DIFFICULTY_H_
+
+#include <Physics.h>
+#include <stdint.h>
+
+// LCD bytes the floor may mark in one game loop pass. A pass should end
+// within one 5 ms floor tick, about 5000 bytes over the polled 16 MHz SPI;
+// the background layers take up to PARALLAX_BUDGET_BYTES of that and the
+// player and score about 1000 more.
+#define DIFFICULTY_FLOOR_BUDGET_BYTES 1950
+
+// The colors a floor can use, the wheel's five
+#define DIFFICULTY_MAX_COLORS 5
+
+typedef struct {
+  int score;          // where these values hold
+  Fix16 scrollSpeed;  // pixels per floor tick
+  int segmentMin;     // segment widths are uniform in segmentMin..segmentMax
+  int segmentMax;
+  int colorCount;     // segments use the first colorCount wheel colors
+  int gapPercent;     // chance a segment is followed by a gap
+} DifficultyPoint;
+
+typedef struct {
+  const char* name;
+  int pointsPerSecond;
+  const DifficultyPoint* points;  // by rising score, at least one
+  int pointCount;
+} DifficultyMode;
+
+extern const DifficultyMode difficultyModes[];
+extern const int difficultyModeCount;
+
+// The values of mode_p at score; the score field is score
+DifficultyPoint Difficulty_at(const DifficultyMode* mode_p, int score);
+
+#endif /* DIFFICULTY_H_ */
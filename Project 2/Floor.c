@@ -0,0 +1,62 @@
+// Floor.c - Scrolling floor kept as a ring of segments
+
+#include <Floor.h>
+#include <stddef.h>
+
+// Empty the ring and put the screen back at floor x 0
+void Floor_init(Floor* floor_p) {
+  floor_p->scroll = 0;
+  floor_p->end = 0;
+  floor_p->head = 0;
+  floor_p->count = 0;
+}
+
+// Whether the segments stop short of the lookahead past the screen
+bool Floor_needsSegment(const Floor* floor_p) {
+  return floor_p->end < floor_p->scroll + FLOOR_VIEW_WIDTH + FLOOR_LOOKAHEAD;
+}
+
+// Append a segment at the end
+bool Floor_push(Floor* floor_p, int width, uint32_t color) {
+  if (floor_p->count == FLOOR_CAPACITY) {
+    return false;
+  }
+
+  FloorSegment* segment_p =
+      &floor_p->segments[(floor_p->head + floor_p->count) & (FLOOR_CAPACITY - 1)];
+  segment_p->x = floor_p->end;
+  segment_p->width = width;
+  segment_p->color = color;
+
+  floor_p->count++;
+  floor_p->end += width;
+  return true;
+}
+
+// Move the screen along the floor; segments themselves never change
+void Floor_scroll(Floor* floor_p, int dx) {
+  floor_p->scroll += dx;
+
+  while (floor_p->count > 0) {
+    const FloorSegment* first_p = &floor_p->segments[floor_p->head];
+    if (first_p->x + first_p->width > floor_p->scroll) {
+      break;
+    }
+    floor_p->head = (floor_p->head + 1) & (FLOOR_CAPACITY - 1);
+    floor_p->count--;
+  }
+}
+
+// Segment under screen column x
+const FloorSegment* Floor_segmentAt(const Floor* floor_p, int x) {
+  int32_t floorX = floor_p->scroll + x;
+  int i;
+
+  for (i = 0; i < floor_p->count; i++) {
+    const FloorSegment* segment_p = Floor_segment(floor_p, i);
+    if (floorX < segment_p->x + segment_p->width) {
+      return floorX >= segment_p->x ? segment_p : NULL;
+    }
+  }
+  return NULL;
+}
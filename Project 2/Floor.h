@@ -0,0 +1,80 @@
+// Floor.h - Scrolling floor kept as a ring of segments
+//
+// Segments are placed in floor coordinates, which never move; scrolling
+// only advances the floor x of the screen's left edge. Segments that have
+// left the screen drop off the head of the ring and new ones are appended
+// at the tail, so a scroll step costs the same however many segments are
+// out, and nothing is ever shifted down. A gap is a segment in the
+// background color, which no color wheel color matches.
+
+#ifndef FLOOR_H_
+#define FLOOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Segments the ring holds; a power of two so indices wrap with a mask
+#define FLOOR_CAPACITY 32
+
+#define FLOOR_VIEW_WIDTH 128
+// The band of screen rows the floor is drawn in
+#define FLOOR_SCREEN_Y 105
+#define FLOOR_SCREEN_HEIGHT 18
+// Segments are generated this far past the right edge of the screen
+#define FLOOR_LOOKAHEAD 32
+
+// Widths the generator can pick, in pixels. Difficulty tables choose the
+// segment widths within these limits.
+#define FLOOR_SEGMENT_MIN 40
+#define FLOOR_SEGMENT_MAX 125
+#define FLOOR_GAP_MIN 6
+#define FLOOR_GAP_MAX 12
+#define FLOOR_GAP_COLOR 0x000000
+
+#if (FLOOR_CAPACITY & (FLOOR_CAPACITY - 1)) != 0
+#error "FLOOR_CAPACITY must be a power of two"
+#endif
+#if FLOOR_CAPACITY < (FLOOR_VIEW_WIDTH + FLOOR_LOOKAHEAD) / FLOOR_GAP_MIN + 2
+#error "FLOOR_CAPACITY cannot hold a screen and lookahead of the narrowest segments"
+#endif
+
+typedef struct {
+  int32_t x;  // floor coordinate of the left edge
+  int width;
+  uint32_t color;
+} FloorSegment;
+
+typedef struct {
+  int32_t scroll;  // floor x at the screen's left edge
+  int32_t end;     // floor x where the next segment goes
+  int head;
+  int count;
+  FloorSegment segments[FLOOR_CAPACITY];
+} Floor;
+
+// Empty the ring and put the screen back at floor x 0
+void Floor_init(Floor* floor_p);
+
+// Whether the segments stop short of the lookahead past the screen
+bool Floor_needsSegment(const Floor* floor_p);
+
+// Append a segment at the end; returns false if the ring is full
+bool Floor_push(Floor* floor_p, int width, uint32_t color);
+
+// Move the screen dx pixels right along the floor and drop what left it
+void Floor_scroll(Floor* floor_p, int dx);
+
+// Segment under screen column x, or NULL past the generated floor
+const FloorSegment* Floor_segmentAt(const Floor* floor_p, int x);
+
+// The ith segment from the left, 0 <= i < count
+static inline const FloorSegment* Floor_segment(const Floor* floor_p, int i) {
+  return &floor_p->segments[(floor_p->head + i) & (FLOOR_CAPACITY - 1)];
+}
+
+// Screen column of a segment's left edge
+static inline int Floor_screenX(const Floor* floor_p, const FloorSegment* segment_p) {
+  return segment_p->x - floor_p->scroll;
+}
+
+#endif /* FLOOR_H_ */
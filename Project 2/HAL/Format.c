@@ -0,0 +1,99 @@
+// Format.c - Number formatting implementation
+
+#include <HAL/Format.h>
+
+// Copy a string
+int Format_string(char* buf, const char* str) {
+    int length = 0;
+    while (str[length]) {
+        buf[length] = str[length];
+        length++;
+    }
+    buf[length] = '\0';
+    return length;
+}
+
+// Unsigned decimal, digits are produced backwards then padded in front
+int Format_uint(char* buf, uint32_t value, int width, char pad) {
+    char digits[FORMAT_MAX_INT_LEN];
+    int count = 0;
+
+    do {
+        digits[count++] = '0' + (value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    int length = 0;
+    while (length < width - count) {
+        buf[length++] = pad;
+    }
+    while (count > 0) {
+        buf[length++] = digits[--count];
+    }
+    buf[length] = '\0';
+    return length;
+}
+
+// Signed decimal; zero padding goes after the sign, space padding before it
+int Format_int(char* buf, int32_t value, int width, char pad) {
+    if (value >= 0) {
+        return Format_uint(buf, (uint32_t)value, width, pad);
+    }
+
+    // Negate as unsigned so INT32_MIN does not overflow
+    uint32_t magnitude = 0u - (uint32_t)value;
+
+    if (pad == '0') {
+        buf[0] = '-';
+        return 1 + Format_uint(buf + 1, magnitude, width - 1, pad);
+    }
+
+    char digits[FORMAT_MAX_INT_LEN];
+    int count = Format_uint(digits, magnitude, 0, pad);
+    int length = 0;
+    while (length < width - count - 1) {
+        buf[length++] = pad;
+    }
+    buf[length++] = '-';
+    return length + Format_string(buf + length, digits);
+}
+
+// Hexadecimal with a fixed number of digits
+int Format_hex(char* buf, uint32_t value, int digits) {
+    static const char hexDigits[] = "0123456789ABCDEF";
+    int i;
+
+    for (i = digits - 1; i >= 0; i--) {
+        buf[i] = hexDigits[value & 0xF];
+        value >>= 4;
+    }
+    buf[digits] = '\0';
+    return digits;
+}
+
+// Fixed-point value such as Q16.16, rounded half away from zero
+int Format_fixed(char* buf, int32_t value, int fracBits, int decimals) {
+    int length = 0;
+    uint32_t magnitude = (uint32_t)value;
+
+    if (value < 0) {
+        buf[length++] = '-';
+        magnitude = 0u - (uint32_t)value;
+    }
+
+    uint32_t scale = 1;
+    int i;
+    for (i = 0; i < decimals; i++) {
+        scale *= 10;
+    }
+
+    // Scale the fraction to decimal places before splitting off the integer
+    uint64_t scaled = ((uint64_t)magnitude * scale + ((uint64_t)1 << fracBits >> 1)) >> fracBits;
+    length += Format_uint(buf + length, (uint32_t)(scaled / scale), 0, ' ');
+
+    if (decimals > 0) {
+        buf[length++] = '.';
+        length += Format_uint(buf + length, (uint32_t)(scaled % scale), decimals, '0');
+    }
+    return length;
+}
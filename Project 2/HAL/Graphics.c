@@ -1,6 +1,8 @@
 // Graphics.c - LCD graphics implementation
 
+#include <HAL/Format.h>
 #include <HAL/Graphics.h>
+#include <HAL/LcdDriver/HAL_MSP_EXP432P401R_Crystalfontz128x128_ST7735.h>
 
 GFX GFX_construct(uint32_t defaultForeground, uint32_t defaultBackground) {
     GFX gfx;
@@ -37,6 +39,12 @@ void GFX_print(GFX* gfx_p, char* string, float row, float col) {
     Graphics_drawString(&gfx_p->context, (int8_t*) string, -1, xPosition, yPosition, OPAQUE_TEXT);
 }
 
+void GFX_printInt(GFX* gfx_p, int32_t value, int width, float row, float col) {
+    char text[FORMAT_MAX_INT_LEN];
+    Format_int(text, value, width, ' ');
+    GFX_print(gfx_p, text, row, col);
+}
+
 void GFX_eraseText(GFX* gfx_p, char* string, float row, float col) {
     uint32_t oldForegroundColor = gfx_p->foreground;
     GFX_setForeground(gfx_p, gfx_p->background);
@@ -116,3 +124,22 @@ void GFX_removeHollowCircle(GFX* gfx_p, int x, int y, int radius) {
 void GFX_drawLine(GFX* gfx_p, int x1, int y1, int x2, int y2) {
     Graphics_drawLine(&gfx_p->context, x1, y1, x2, y2);
 }
+
+// 24-bit RGB to the LCD's 16-bit 5-6-5 pixel, high byte sent first
+uint16_t GFX_toPixel(uint32_t color) {
+    return ((color & 0xF80000) >> 8) | ((color & 0x00FC00) >> 5) | ((color & 0x0000F8) >> 3);
+}
+
+// Opens an LCD window; pixels written next fill it row by row, left to right
+void GFX_startWindow(GFX* gfx_p, int x1, int y1, int x2, int y2) {
+    Crystalfontz128x128_SetDrawFrame(x1, y1, x2, y2);
+    HAL_LCD_writeCommand(CM_RAMWR);
+}
+
+void GFX_writePixels(GFX* gfx_p, const uint16_t* pixels, int count) {
+    int i;
+    for (i = 0; i < count; i++) {
+        HAL_LCD_writeData(pixels[i] >> 8);
+        HAL_LCD_writeData(pixels[i]);
+    }
+}
@@ -25,6 +25,7 @@ void GFX_resetColors(GFX* gfx_p);
 void GFX_clear(GFX* gfx_p);
 
 void GFX_print(GFX* gfx_p, char* string, float row, float col);
+void GFX_printInt(GFX* gfx_p, int32_t value, int width, float row, float col);
 void GFX_eraseText(GFX* gfx_p, char* string, float row, float col);
 int GFX_printTextRows(GFX* gfx_p, char* strings[], int numStrings, float firstRow, float col);
 
@@ -42,4 +43,8 @@ void GFX_removeSolidRectangle(GFX* gfx_p, int x1, int x2, int y1, int y2);
 
 void GFX_drawLine(GFX* gfx_p, int x1, int y1, int x2, int y2);
 
+uint16_t GFX_toPixel(uint32_t color);
+void GFX_startWindow(GFX* gfx_p, int x1, int y1, int x2, int y2);
+void GFX_writePixels(GFX* gfx_p, const uint16_t* pixels, int count);
+
 #endif /* HAL_GRAPHICS_H_ */
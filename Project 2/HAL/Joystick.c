@@ -1,53 +1,306 @@
 // Joystick.c - Joystick ADC implementation
 
 #include <HAL/Joystick.h>
+#include <stdlib.h>
 
-void initADC() {
-    ADC14_enableModule();
-    ADC14_initModule(ADC_CLOCKSOURCE_SYSOSC, ADC_PREDIVIDER_1, ADC_DIVIDER_1, 0);
-    ADC14_configureMultiSequenceMode(ADC_MEM0, ADC_MEM1, true);
-    ADC14_enableSampleTimer(ADC_AUTOMATIC_ITERATION);
+// Conversion memories per axis: X in the even ones, Y in the odd ones
+#define X_MEMORIES 0x5555
+#define Y_MEMORIES 0xAAAA
+
+// SMCLK / 48 is 1 MHz, so the timer counts microseconds
+#define TIMER_DIVIDER TIMER_A_CLOCKSOURCE_DIVIDER_48
+
+// Filter state in 1/16 ADC counts, so a small step still moves it
+#define FILTER_FRACTION_BITS 4
+
+// The uDMA control table must sit on a 1024-byte boundary
+#if defined(__TI_COMPILER_VERSION__)
+#pragma DATA_ALIGN(controlTable, 1024)
+static DMA_ControlTable controlTable[32];
+#else
+static DMA_ControlTable controlTable[32] __attribute__((aligned(1024)));
+#endif
+
+static uint32_t ring[2][JOYSTICK_SEQUENCE_LENGTH];
+static volatile int32_t filteredX = JOYSTICK_CENTER << FILTER_FRACTION_BITS;
+static volatile int32_t filteredY = JOYSTICK_CENTER << FILTER_FRACTION_BITS;
+static bool filterPrimed;
+static volatile uint32_t halvesFiltered;
+
+// tan(22.5 degrees) is about 53 / 128: an axis less than that fraction of
+// the other doesn't count, so each direction gets a 45 degree sector
+#define SECTOR_NUMERATOR 53
+#define SECTOR_DENOMINATOR 128
+
+// By vertical then horizontal sign, each -1, 0 or 1 shifted up by 1
+static const JoystickDirection directions[3][3] = {
+    {JOYSTICK_DOWN_LEFT, JOYSTICK_DOWN, JOYSTICK_DOWN_RIGHT},
+    {JOYSTICK_LEFT, JOYSTICK_NONE, JOYSTICK_RIGHT},
+    {JOYSTICK_UP_LEFT, JOYSTICK_UP, JOYSTICK_UP_RIGHT},
+};
+
+// Point a control structure at ring half half for the next sequence
+static void armHalf(uint32_t select, int half) {
+  DMA_setChannelControl(DMA_CH7_ADC14 | select,
+                        UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_32 | UDMA_ARB_16);
+  DMA_setChannelTransfer(DMA_CH7_ADC14 | select, UDMA_MODE_PINGPONG, (void*)&ADC14->MEM[0],
+                         ring[half], JOYSTICK_SEQUENCE_LENGTH);
 }
 
-void startADC() {
-   ADC14_enableConversion();
-   ADC14_toggleConversionTrigger();
+// A ring half is full. Re-arm its control structure, which the channel has
+// just switched away from, then filter the half's average. The first half
+// sets the filter outright rather than easing it in from center.
+void DMA_INT1_IRQHandler(void) {
+  int half;
+  int32_t sumX = 0;
+  int32_t sumY = 0;
+  int i;
+
+  if (DMA_getChannelAttribute(7) & UDMA_ATTR_ALTSELECT) {
+    half = 0;
+    armHalf(UDMA_PRI_SELECT, 0);
+  } else {
+    half = 1;
+    armHalf(UDMA_ALT_SELECT, 1);
+  }
+
+  for (i = 0; i < JOYSTICK_SEQUENCE_LENGTH; i += 2) {
+    sumX += ring[half][i] & 0x3FFF;
+    sumY += ring[half][i + 1] & 0x3FFF;
+  }
+  // The mean of eight samples, in filter units
+  int32_t meanX = sumX << (FILTER_FRACTION_BITS - 3);
+  int32_t meanY = sumY << (FILTER_FRACTION_BITS - 3);
+
+  if (!filterPrimed) {
+    filteredX = meanX;
+    filteredY = meanY;
+    filterPrimed = true;
+  } else {
+    filteredX += (meanX - filteredX) >> JOYSTICK_IIR_SHIFT;
+    filteredY += (meanY - filteredY) >> JOYSTICK_IIR_SHIFT;
+  }
+  halvesFiltered++;
 }
 
-void initJoyStick() {
-    // X axis
-    ADC14_configureConversionMemory(ADC_MEM0,
-                                  ADC_VREFPOS_AVCC_VREFNEG_VSS,
-                                  ADC_INPUT_A15,
+// A repeating sequence over all sixteen memories, one conversion per
+// rising edge of Timer_A0 CCR1
+static void initADC() {
+  ADC14_enableModule();
+  ADC14_initModule(ADC_CLOCKSOURCE_SYSOSC, ADC_PREDIVIDER_1, ADC_DIVIDER_1, 0);
+  ADC14_configureMultiSequenceMode(ADC_MEM0, ADC_MEM15, true);
+  ADC14_configureConversionMemory(X_MEMORIES, ADC_VREFPOS_AVCC_VREFNEG_VSS, ADC_INPUT_A15,
                                   ADC_NONDIFFERENTIAL_INPUTS);
-    GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P6,
-                                               GPIO_PIN0,
-                                               GPIO_TERTIARY_MODULE_FUNCTION);
+  ADC14_configureConversionMemory(Y_MEMORIES, ADC_VREFPOS_AVCC_VREFNEG_VSS, ADC_INPUT_A9,
+                                  ADC_NONDIFFERENTIAL_INPUTS);
+  ADC14_setSampleHoldTrigger(ADC_TRIGGER_SOURCE1, false);
+  ADC14_enableSampleTimer(ADC_MANUAL_ITERATION);
+
+  // X axis on P6.0, Y axis on P4.4
+  GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P6, GPIO_PIN0,
+                                             GPIO_TERTIARY_MODULE_FUNCTION);
+  GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P4, GPIO_PIN4,
+                                             GPIO_TERTIARY_MODULE_FUNCTION);
+}
+
+// Channel 7 is the ADC's, ping-ponging between the ring halves
+static void initDMA() {
+  DMA_enableModule();
+  DMA_setControlBase(controlTable);
+  DMA_assignChannel(DMA_CH7_ADC14);
+  DMA_disableChannelAttribute(DMA_CH7_ADC14, UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST |
+                                                 UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+  armHalf(UDMA_PRI_SELECT, 0);
+  armHalf(UDMA_ALT_SELECT, 1);
+
+  DMA_assignInterrupt(DMA_INT1, 7);
+  DMA_clearInterruptFlag(7);
+  Interrupt_enableInterrupt(INT_DMA_INT1);
+  DMA_enableChannel(7);
+}
+
+// CCR1 in set/reset mode gives one rising edge, one conversion, a period
+static void initTimer() {
+  Timer_A_UpModeConfig upConfig = {
+      TIMER_A_CLOCKSOURCE_SMCLK,
+      TIMER_DIVIDER,
+      JOYSTICK_SAMPLE_PERIOD_US - 1,
+      TIMER_A_TAIE_INTERRUPT_DISABLE,
+      TIMER_A_CCIE_CCR0_INTERRUPT_DISABLE,
+      TIMER_A_DO_CLEAR
+  };
+  Timer_A_CompareModeConfig compareConfig = {
+      TIMER_A_CAPTURECOMPARE_REGISTER_1,
+      TIMER_A_CAPTURECOMPARE_INTERRUPT_DISABLE,
+      TIMER_A_OUTPUTMODE_SET_RESET,
+      JOYSTICK_SAMPLE_PERIOD_US / 2
+  };
+  Timer_A_configureUpMode(TIMER_A0_BASE, &upConfig);
+  Timer_A_initCompare(TIMER_A0_BASE, &compareConfig);
+}
 
-    // Y axis
-    ADC14_configureConversionMemory(ADC_MEM1,
-                                      ADC_VREFPOS_AVCC_VREFNEG_VSS,
-                                      ADC_INPUT_A9,
-                                      ADC_NONDIFFERENTIAL_INPUTS);
-    GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P4,
-                                               GPIO_PIN4,
-                                               GPIO_TERTIARY_MODULE_FUNCTION);
+// One axis's measured center, or the nominal one if the stick was pushed
+static int calibratedCenter(int32_t filtered) {
+  int center = filtered >> FILTER_FRACTION_BITS;
+  if (abs(center - JOYSTICK_CENTER) > JOYSTICK_RELEASE_ZONE) {
+    return JOYSTICK_CENTER;
+  }
+  return center;
 }
 
-void getSampleJoyStick(unsigned *X, unsigned *Y) {
-    *X = ADC14_getResult(ADC_MEM0);
-    *Y = ADC14_getResult(ADC_MEM1);
+// Start sampling, then wait for the filter to settle on the resting
+// position and take it as center
+static void calibrate(Joystick* joystick_p) {
+  SWTimer timeout = SWTimer_construct(JOYSTICK_CALIBRATION_TIMEOUT_MS);
+
+  SWTimer_start(&timeout);
+  while (halvesFiltered < JOYSTICK_CALIBRATION_HALVES && !SWTimer_expired(&timeout)) {
+  }
+  joystick_p->centerX = calibratedCenter(filteredX);
+  joystick_p->centerY = calibratedCenter(filteredY);
 }
 
 Joystick Joystick_construct() {
-  Joystick Joystick;
+  Joystick joystick;
+  joystick.x = JOYSTICK_CENTER;
+  joystick.y = JOYSTICK_CENTER;
+  joystick.zones.press = JOYSTICK_PRESS_ZONE;
+  joystick.zones.release = JOYSTICK_RELEASE_ZONE;
+  joystick.direction = JOYSTICK_NONE;
+  joystick.axis = JOYSTICK_NONE;
+  joystick.tapped = JOYSTICK_NONE;
+  joystick.repeated = JOYSTICK_NONE;
+  joystick.repeatTimer = SWTimer_construct(JOYSTICK_REPEAT_DELAY_MS);
+  joystick.repeatInterval_ms = JOYSTICK_REPEAT_START_MS;
+
   initADC();
-  initJoyStick();
-  startADC();
-  return Joystick;
+  initDMA();
+  initTimer();
+  ADC14_enableConversion();
+  Timer_A_startCounter(TIMER_A0_BASE, TIMER_A_UP_MODE);
+  calibrate(&joystick);
+  return joystick;
+}
+
+// Replace the default press and release zones
+void Joystick_setZones(Joystick* joystick_p, JoystickZones zones) {
+  joystick_p->zones = zones;
 }
 
+// The sector the stick points into, from its angle alone
+static JoystickDirection sectorOf(int dx, int dy) {
+  int ax = abs(dx);
+  int ay = abs(dy);
+  int horizontal = ax * SECTOR_DENOMINATOR > ay * SECTOR_NUMERATOR ? (dx > 0 ? 1 : -1) : 0;
+  int vertical = ay * SECTOR_DENOMINATOR > ax * SECTOR_NUMERATOR ? (dy > 0 ? 1 : -1) : 0;
+
+  return directions[vertical + 1][horizontal + 1];
+}
+
+// Whichever axis the stick is pushed further along
+static JoystickDirection axisOf(int dx, int dy) {
+  if (abs(dx) > abs(dy)) {
+    return dx > 0 ? JOYSTICK_RIGHT : JOYSTICK_LEFT;
+  }
+  return dy > 0 ? JOYSTICK_UP : JOYSTICK_DOWN;
+}
+
+// The next auto-repeat comes after interval_ms
+static void scheduleRepeat(Joystick* joystick_p, int interval_ms) {
+  joystick_p->repeatTimer = SWTimer_construct(interval_ms);
+  SWTimer_start(&joystick_p->repeatTimer);
+}
+
+// Read the filter and step the gesture state machine: centered until an
+// axis passes the press zone, then held in the sector it entered until
+// both axes are inside the release zone. It repeats only while still past
+// the press zone, so letting go never scrolls a menu one more step.
 void Joystick_refresh(Joystick* joystick_p) {
-    joystick_p->x = ADC14_getResult(ADC_MEM0);
-    joystick_p->y = ADC14_getResult(ADC_MEM1);
+  joystick_p->x = filteredX >> FILTER_FRACTION_BITS;
+  joystick_p->y = filteredY >> FILTER_FRACTION_BITS;
+
+  int dx = (int)joystick_p->x - joystick_p->centerX;
+  int dy = (int)joystick_p->y - joystick_p->centerY;
+  int press = joystick_p->zones.press;
+  int release = joystick_p->zones.release;
+
+  joystick_p->tapped = JOYSTICK_NONE;
+  joystick_p->repeated = JOYSTICK_NONE;
+  if (joystick_p->direction == JOYSTICK_NONE) {
+    if (abs(dx) > press || abs(dy) > press) {
+      joystick_p->direction = sectorOf(dx, dy);
+      joystick_p->axis = axisOf(dx, dy);
+      joystick_p->tapped = joystick_p->direction;
+      joystick_p->repeated = joystick_p->direction;
+      scheduleRepeat(joystick_p, JOYSTICK_REPEAT_DELAY_MS);
+      joystick_p->repeatInterval_ms = JOYSTICK_REPEAT_START_MS;
+    }
+  } else if (abs(dx) < release && abs(dy) < release) {
+    joystick_p->direction = JOYSTICK_NONE;
+    joystick_p->axis = JOYSTICK_NONE;
+  } else if ((abs(dx) > press || abs(dy) > press) && SWTimer_expired(&joystick_p->repeatTimer)) {
+    joystick_p->repeated = joystick_p->direction;
+    scheduleRepeat(joystick_p, joystick_p->repeatInterval_ms);
+    joystick_p->repeatInterval_ms -= joystick_p->repeatInterval_ms / 4;
+    if (joystick_p->repeatInterval_ms < JOYSTICK_REPEAT_MIN_MS) {
+      joystick_p->repeatInterval_ms = JOYSTICK_REPEAT_MIN_MS;
+    }
+  }
+}
+
+// The direction held, or JOYSTICK_NONE
+JoystickDirection Joystick_direction(Joystick* joystick_p) {
+  return joystick_p->direction;
+}
+
+bool Joystick_isPressed(Joystick* joystick_p, JoystickDirection direction) {
+  return direction != JOYSTICK_NONE && joystick_p->direction == direction;
+}
+
+bool Joystick_isTapped(Joystick* joystick_p, JoystickDirection direction) {
+  return direction != JOYSTICK_NONE && joystick_p->tapped == direction;
+}
+
+bool Joystick_isRepeated(Joystick* joystick_p, JoystickDirection direction) {
+  return direction != JOYSTICK_NONE && joystick_p->repeated == direction;
+}
+
+JoystickDirection Joystick_tapped4(Joystick* joystick_p) {
+  return joystick_p->tapped != JOYSTICK_NONE ? joystick_p->axis : JOYSTICK_NONE;
+}
+
+JoystickDirection Joystick_repeated4(Joystick* joystick_p) {
+  return joystick_p->repeated != JOYSTICK_NONE ? joystick_p->axis : JOYSTICK_NONE;
+}
+
+bool Joystick_isPressedToLeft(Joystick* joystick_p) {
+  return joystick_p->axis == JOYSTICK_LEFT;
+}
+
+bool Joystick_isPressedToRight(Joystick* joystick_p) {
+  return joystick_p->axis == JOYSTICK_RIGHT;
+}
+
+bool Joystick_isPressedUp(Joystick* joystick_p) {
+  return joystick_p->axis == JOYSTICK_UP;
+}
+
+bool Joystick_isPressedDown(Joystick* joystick_p) {
+  return joystick_p->axis == JOYSTICK_DOWN;
+}
+
+bool Joystick_isTappedToLeft(Joystick* joystick_p) {
+  return Joystick_tapped4(joystick_p) == JOYSTICK_LEFT;
+}
+
+bool Joystick_isTappedToRight(Joystick* joystick_p) {
+  return Joystick_tapped4(joystick_p) == JOYSTICK_RIGHT;
+}
+
+bool Joystick_isTappedUp(Joystick* joystick_p) {
+  return Joystick_tapped4(joystick_p) == JOYSTICK_UP;
+}
+
+bool Joystick_isTappedDown(Joystick* joystick_p) {
+  return Joystick_tapped4(joystick_p) == JOYSTICK_DOWN;
 }
@@ -1,19 +1,122 @@
-// Joystick.h - Joystick input via ADC
+// Joystick.h - Joystick input via timer-triggered ADC and DMA
+//
+// Timer_A0 starts a conversion every JOYSTICK_SAMPLE_PERIOD_US, with no
+// CPU involved. The ADC runs a repeating sequence of sixteen conversion
+// memories, X (A15) and Y (A9) in turn, so each axis is sampled at 1 kHz.
+// At the end of each sequence the ADC requests DMA, which copies the
+// sixteen results into one half of a ring while the other half is kept for
+// the CPU. The DMA interrupt averages the half it just finished, eight
+// samples per axis, and folds the averages into a first-order IIR filter,
+// so the main loop reads two filtered values and never a raw sample.
+//
+// Joystick_refresh turns the filtered position into gestures with
+// hysteresis, at a fixed cost per call. A push starts when either axis
+// moves further than the press zone from center, and is classified then
+// into one of eight directions by its angle, 45 degrees each. The
+// direction holds until both axes are back within the release zone, so
+// noise around a threshold never gives a second tap, and rolling the stick
+// around the edge doesn't change what is held. Its main axis, the one
+// pushed further, is kept too, for callers that only know four directions:
+// to them a push a little off axis is still up, down, left or right.
+// Center is measured while
+// Joystick_construct waits for the first samples, so the stick must be
+// left alone at reset; one held off center gets the nominal center.
+//
+// A held direction also repeats for menus: once after
+// JOYSTICK_REPEAT_DELAY_MS, then faster and faster down to
+// JOYSTICK_REPEAT_MIN_MS apart.
 
 #ifndef HAL_JOYSTICK_H_
 #define HAL_JOYSTICK_H_
 
+#include <HAL/Timer.h>
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
 
+#define JOYSTICK_SAMPLE_PERIOD_US 500
+// Conversions per ADC sequence, alternating X and Y; one ring half
+#define JOYSTICK_SEQUENCE_LENGTH 16
+// Each half's average moves the filter 1 / 2^shift of the way, a time
+// constant of about 32 ms
+#define JOYSTICK_IIR_SHIFT 2
+
+// 14-bit ADC counts
+#define JOYSTICK_CENTER 8192
+#define JOYSTICK_PRESS_ZONE 5500
+#define JOYSTICK_RELEASE_ZONE 2000
+
+// Ring halves averaged for the center at construction, 8 ms each
+#define JOYSTICK_CALIBRATION_HALVES 4
+#define JOYSTICK_CALIBRATION_TIMEOUT_MS 100
+
+#define JOYSTICK_REPEAT_DELAY_MS 400
+#define JOYSTICK_REPEAT_START_MS 160
+#define JOYSTICK_REPEAT_MIN_MS 40
+
+typedef enum {
+  JOYSTICK_NONE,
+  JOYSTICK_UP,
+  JOYSTICK_DOWN,
+  JOYSTICK_LEFT,
+  JOYSTICK_RIGHT,
+  JOYSTICK_UP_LEFT,
+  JOYSTICK_UP_RIGHT,
+  JOYSTICK_DOWN_LEFT,
+  JOYSTICK_DOWN_RIGHT
+} JoystickDirection;
+
+// Distances from center, in ADC counts
+typedef struct {
+  int press;    // an axis past this enters a direction
+  int release;  // both axes within this leave it
+} JoystickZones;
+
 struct _Joystick {
-    uint_fast16_t x;
+    uint_fast16_t x;  // filtered, in ADC counts; up and right are high
     uint_fast16_t y;
+    int centerX;      // measured at construction
+    int centerY;
+    JoystickZones zones;
+    JoystickDirection direction;  // held now; JOYSTICK_NONE when centered
+    JoystickDirection axis;       // main axis of the held direction
+    JoystickDirection tapped;     // entered on the last refresh
+    JoystickDirection repeated;   // tapped or repeated on the last refresh
+    SWTimer repeatTimer;
+    int repeatInterval_ms;        // until the repeat after the next one
 };
 typedef struct _Joystick Joystick;
 
 Joystick Joystick_construct();
+void Joystick_refresh(Joystick* Joystick);
+
+// Replace the default press and release zones
+void Joystick_setZones(Joystick* joystick_p, JoystickZones zones);
+
+// The direction held, or JOYSTICK_NONE
+JoystickDirection Joystick_direction(Joystick* joystick_p);
+
+// Whether direction is held
+bool Joystick_isPressed(Joystick* joystick_p, JoystickDirection direction);
+
+// Whether direction was entered from center on the last refresh
+bool Joystick_isTapped(Joystick* joystick_p, JoystickDirection direction);
+
+// Whether direction was tapped or auto-repeated on the last refresh
+bool Joystick_isRepeated(Joystick* joystick_p, JoystickDirection direction);
+
+// The main axis of what was tapped, or tapped or auto-repeated, on the
+// last refresh; JOYSTICK_NONE if nothing was. Never a diagonal.
+JoystickDirection Joystick_tapped4(Joystick* joystick_p);
+JoystickDirection Joystick_repeated4(Joystick* joystick_p);
+
+// The four directions by main axis, so diagonal pushes count too
+
 bool Joystick_isPressedToLeft(Joystick* Joystick);
+bool Joystick_isPressedToRight(Joystick* Joystick);
+bool Joystick_isPressedUp(Joystick* Joystick);
+bool Joystick_isPressedDown(Joystick* Joystick);
 bool Joystick_isTappedToLeft(Joystick* Joystick);
-void Joystick_refresh(Joystick* Joystick);
+bool Joystick_isTappedToRight(Joystick* Joystick);
+bool Joystick_isTappedUp(Joystick* Joystick);
+bool Joystick_isTappedDown(Joystick* Joystick);
 
 #endif /* HAL_JOYSTICK_H_ */
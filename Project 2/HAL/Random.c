@@ -0,0 +1,135 @@
+// Random.c - Seeded random number streams
+
+#include <HAL/Random.h>
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+
+// Conversions mixed into a boot seed; each gives a bit or two of noise
+#define ENTROPY_SAMPLES 64
+
+// xoshiro128 jump polynomial: advances a stream by 2^64 numbers
+static const uint32_t jumpPolynomial[4] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+
+static uint32_t rotateLeft(uint32_t x, int k) {
+  return (x << k) | (x >> (32 - k));
+}
+
+// SplitMix32 step: spreads a counter into well-mixed words for the state
+static uint32_t splitMix(uint32_t* counter_p) {
+  uint32_t z = (*counter_p += 0x9E3779B9);
+  z = (z ^ (z >> 16)) * 0x85EBCA6B;
+  z = (z ^ (z >> 13)) * 0xC2B2AE35;
+  return z ^ (z >> 16);
+}
+
+static void jump(Random* random_p) {
+  uint32_t s[4] = { 0, 0, 0, 0 };
+  int i, b, k;
+
+  for (i = 0; i < 4; i++) {
+    for (b = 0; b < 32; b++) {
+      if (jumpPolynomial[i] & (1u << b)) {
+        for (k = 0; k < 4; k++) {
+          s[k] ^= random_p->s[k];
+        }
+      }
+      Random_next(random_p);
+    }
+  }
+  for (k = 0; k < 4; k++) {
+    random_p->s[k] = s[k];
+  }
+}
+
+// Start stream number stream of seed
+void Random_init(Random* random_p, uint32_t seed, int stream) {
+  int k;
+
+  for (k = 0; k < 4; k++) {
+    random_p->s[k] = splitMix(&seed);
+  }
+  // All zero is the one state xoshiro can't leave
+  if ((random_p->s[0] | random_p->s[1] | random_p->s[2] | random_p->s[3]) == 0) {
+    random_p->s[0] = 1;
+  }
+  while (stream-- > 0) {
+    jump(random_p);
+  }
+}
+
+// The next 32 random bits
+uint32_t Random_next(Random* random_p) {
+  uint32_t* s = random_p->s;
+  uint32_t result = rotateLeft(s[1] * 5, 7) * 9;
+  uint32_t t = s[1] << 9;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = rotateLeft(s[3], 11);
+  return result;
+}
+
+// Lemire's method: the high word of a 32x32 multiply is the result, and the
+// low word tells whether it fell in the few values that would bias it. The
+// division that finds those is only done when the low word is small enough
+// to be one of them.
+uint32_t Random_below(Random* random_p, uint32_t bound) {
+  uint64_t m = (uint64_t)Random_next(random_p) * bound;
+  uint32_t low = (uint32_t)m;
+
+  if (low < bound) {
+    uint32_t threshold = (0u - bound) % bound;
+    while (low < threshold) {
+      m = (uint64_t)Random_next(random_p) * bound;
+      low = (uint32_t)m;
+    }
+  }
+  return (uint32_t)(m >> 32);
+}
+
+// Uniform in low .. high inclusive
+int Random_range(Random* random_p, int low, int high) {
+  return low + (int)Random_below(random_p, (uint32_t)(high - low + 1));
+}
+
+// A22 reads pin P8.3 while the temperature sensor is not mapped onto it.
+// Nothing on the LaunchPad or BoosterPack drives that pin, so it floats and
+// its low bits are noise. The conversion time, on the ADC's own oscillator,
+// also jitters against the CPU clock, so the timer after each conversion
+// adds a little more. Both go through a multiply-rotate mix and SplitMix.
+uint32_t Random_gatherEntropy(void) {
+  uint32_t hash = 0;
+  int i;
+
+  GPIO_setAsPeripheralModuleFunctionInputPin(GPIO_PORT_P8, GPIO_PIN3,
+                                             GPIO_TERTIARY_MODULE_FUNCTION);
+  ADC14_enableModule();
+  ADC14_initModule(ADC_CLOCKSOURCE_SYSOSC, ADC_PREDIVIDER_1, ADC_DIVIDER_1, 0);
+  ADC14_configureSingleSampleMode(ADC_MEM0, false);
+  ADC14_configureConversionMemory(ADC_MEM0, ADC_VREFPOS_AVCC_VREFNEG_VSS, ADC_INPUT_A22,
+                                  ADC_NONDIFFERENTIAL_INPUTS);
+  ADC14_enableSampleTimer(ADC_MANUAL_ITERATION);
+  ADC14_enableConversion();
+
+  for (i = 0; i < ENTROPY_SAMPLES; i++) {
+    ADC14_toggleConversionTrigger();
+    while (ADC14_isBusy()) {
+    }
+    hash = rotateLeft((hash ^ ADC14_getResult(ADC_MEM0)) * 0x9E3779B1, 5);
+    hash ^= Timer32_getValue(TIMER32_0_BASE);
+  }
+
+  ADC14_disableConversion();
+  ADC14_disableModule();
+  return splitMix(&hash);
+}
+
+// RANDOM_FIXED_SEED if set, otherwise a seed from Random_gatherEntropy
+uint32_t Random_bootSeed(void) {
+  if (RANDOM_FIXED_SEED != 0) {
+    return RANDOM_FIXED_SEED;
+  }
+  return Random_gatherEntropy();
+}
@@ -0,0 +1,42 @@
+// ScoreFlash.c - Two flash sectors set aside for the high-score log
+
+#include <HAL/ScoreFlash.h>
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+
+// The linker places this array on the sectors, so a program whose code or
+// constants grow into them fails to link instead of being erased by the
+// log. NOINIT leaves it out of the image, so flashing a new build keeps
+// the scores.
+#if defined(__TI_COMPILER_VERSION__)
+#pragma LOCATION(reserved, SCOREFLASH_ADDRESS)
+#pragma NOINIT(reserved)
+#pragma RETAIN(reserved)
+static uint8_t reserved[SCOREFLASH_SECTORS][SCOREFLASH_SECTOR_SIZE];
+#endif
+
+static const uint32_t sectorAddress[SCOREFLASH_SECTORS] = {
+  SCOREFLASH_ADDRESS, SCOREFLASH_ADDRESS + SCOREFLASH_SECTOR_SIZE
+};
+static const uint32_t sectorMask[SCOREFLASH_SECTORS] = { FLASH_SECTOR30, FLASH_SECTOR31 };
+
+// Flash is memory-mapped, so reading needs no driver call
+const uint8_t* ScoreFlash_sector(int index) {
+  return (const uint8_t*)(uintptr_t)sectorAddress[index];
+}
+
+// Sectors stay write-protected except during one erase or program call
+bool ScoreFlash_erase(int index) {
+  FlashCtl_unprotectSector(FLASH_MAIN_MEMORY_SPACE_BANK1, sectorMask[index]);
+  bool done = FlashCtl_eraseSector(sectorAddress[index]);
+  FlashCtl_protectSector(FLASH_MAIN_MEMORY_SPACE_BANK1, sectorMask[index]);
+  return done;
+}
+
+// Program length bytes at offset in a sector
+bool ScoreFlash_program(int index, int offset, const void* data, int length) {
+  FlashCtl_unprotectSector(FLASH_MAIN_MEMORY_SPACE_BANK1, sectorMask[index]);
+  void* dest = (void*)(uintptr_t)(sectorAddress[index] + offset);
+  bool done = FlashCtl_programMemory((void*)data, dest, length);
+  FlashCtl_protectSector(FLASH_MAIN_MEMORY_SPACE_BANK1, sectorMask[index]);
+  return done;
+}
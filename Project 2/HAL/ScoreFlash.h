@@ -0,0 +1,29 @@
+// ScoreFlash.h - Two flash sectors set aside for the high-score log
+//
+// The sectors are the last two 4 KB sectors of main flash bank 1
+// (0x3E000 and 0x3F000), reserved at link time by ScoreFlash.c. Erased
+// flash reads 0xFF and programming can only clear bits, so a byte is
+// written once per erase. ScoreLog.c is the only user; it is the same as Project
+// 1's, whose tools/scorelog_sim.c tests it against a simulated flash.
+
+#ifndef HAL_SCOREFLASH_H_
+#define HAL_SCOREFLASH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SCOREFLASH_SECTORS 2
+#define SCOREFLASH_SECTOR_SIZE 4096
+// Sector 30 of bank 1; sector 31 follows it
+#define SCOREFLASH_ADDRESS 0x0003E000
+
+// Start of sector index (0 or 1), readable like any memory
+const uint8_t* ScoreFlash_sector(int index);
+
+// Set a whole sector back to 0xFF; returns false if the erase failed
+bool ScoreFlash_erase(int index);
+
+// Program length bytes at offset in a sector; returns false on failure
+bool ScoreFlash_program(int index, int offset, const void* data, int length);
+
+#endif /* HAL_SCOREFLASH_H_ */
@@ -59,7 +59,7 @@ uint64_t SWTimer_elapsedCycles(SWTimer* timer_p) {
   uint64_t startCounter = timer_p->startCounter;
   uint64_t currentCounter = Timer32_getValue(TIMER32_0_BASE);
   uint64_t elapsedCycles =
-      (rollovers * (LOADVALUE + 1)) + startCounter - currentCounter;
+      (rollovers * ((uint64_t)LOADVALUE + 1)) + startCounter - currentCounter;
 
   return elapsedCycles;
 }
@@ -70,6 +70,25 @@ bool SWTimer_expired(SWTimer* timer_p) {
   return elapsedCycles >= timer_p->cyclesToWait;
 }
 
+// Count the whole wait times that have passed and move the start forward by
+// exactly that much, so the leftover fraction carries into the next call.
+// For fixed-step updates that must not drift with how often they are polled.
+uint32_t SWTimer_takePeriods(SWTimer* timer_p) {
+  uint64_t periods = SWTimer_elapsedCycles(timer_p) / timer_p->cyclesToWait;
+  if (periods == 0) {
+    return 0;
+  }
+
+  // The start as one count of cycles; the counter runs down, so it is the
+  // rollovers less the counter, taken modulo 2^64
+  uint64_t start = ((uint64_t)timer_p->startRollovers << 32) - timer_p->startCounter;
+  start += periods * timer_p->cyclesToWait;
+
+  timer_p->startCounter = (uint32_t)(0 - start);
+  timer_p->startRollovers = (uint32_t)((start + timer_p->startCounter) >> 32);
+  return (uint32_t)periods;
+}
+
 // Get elapsed time in microseconds
 uint64_t SWTimer_elapsedTimeUS(SWTimer* timer_p) {
   uint64_t elapsedCycles = SWTimer_elapsedCycles(timer_p);
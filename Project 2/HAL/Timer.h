@@ -22,6 +22,7 @@ SWTimer SWTimer_construct(uint64_t waitTime_ms);
 void SWTimer_start(SWTimer* timer);
 uint64_t SWTimer_elapsedCycles(SWTimer* timer);
 bool SWTimer_expired(SWTimer* timer);
+uint32_t SWTimer_takePeriods(SWTimer* timer);
 void InitSystemTiming();
 
 #endif /* HAL_TIMER_H_ */
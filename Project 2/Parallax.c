@@ -0,0 +1,188 @@
+// Parallax.c - Scrolling background layers behind the runner
+
+#include <Parallax.h>
+
+typedef struct {
+  const uint8_t* map;  // tile numbers, top tile row first
+  int mapWidth;        // in tiles; a power of two so columns wrap with a mask
+  int tileRows;
+  int top;             // first screen row
+  int rateShift;       // scrolls at the floor's speed >> rateShift
+  uint32_t color;
+} ParallaxLayer;
+
+// A column per byte, bit 0 at the top
+static const uint8_t tiles[][8] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // 0 empty
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},  // 1 solid
+    {0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0},  // 2 low roof
+    {0x00, 0x00, 0xC0, 0xFE, 0xC0, 0x00, 0x00, 0x00},  // 3 antenna
+    {0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF},  // 4 roof sloping up
+    {0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80},  // 5 roof sloping down
+    {0x40, 0x40, 0x40, 0xF0, 0xF0, 0x40, 0x40, 0x40},  // 6 fence post top
+    {0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40},  // 7 top rail
+    {0x10, 0x10, 0x10, 0xFF, 0xFF, 0x10, 0x10, 0x10},  // 8 fence post foot
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},  // 9 bottom rail
+    {0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFC, 0xF8, 0xE0},  // 10 bush
+};
+
+// Far skyline, 256 pixels around
+static const uint8_t skylineMap[4 * 32] = {
+    0, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 1, 1, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 2, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 4, 5,
+    1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 0, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1,
+};
+
+// Near fence with bushes, 128 pixels around
+static const uint8_t fenceMap[2 * 16] = {
+    6, 7, 6, 7, 7, 6, 7, 6, 7, 7, 6, 7, 6, 7, 7, 7,
+    8, 9, 8, 10, 9, 8, 9, 8, 10, 9, 8, 9, 8, 9, 10, 9,
+};
+
+// Nearest first, so the layer that changes most is never the one starved
+static const ParallaxLayer layers[PARALLAX_LAYERS] = {
+    {fenceMap, 16, 2, 88, 1, 0x505050},
+    {skylineMap, 32, 4, 56, 2, 0x202050},
+};
+
+// The pixels of map column column, bit 0 at the top; a blank column is 0.
+// Layers are at most four tiles tall, so a column fits in 32 bits.
+static uint32_t columnBits(const ParallaxLayer* layer_p, int column) {
+  uint32_t bits = 0;
+  int r;
+
+  if (column < 0) {
+    return 0;
+  }
+  for (r = 0; r < layer_p->tileRows; r++) {
+    uint8_t tile = layer_p->map[r * layer_p->mapWidth + (column >> 3)];
+    bits |= (uint32_t)tiles[tile][column & 7] << (r * 8);
+  }
+  return bits;
+}
+
+static void markRun(Sprites* sprites_p, const ParallaxLayer* layer_p, int x1, int x2) {
+  Sprites_invalidate(sprites_p, SpriteRect_make(x1, layer_p->top, x2,
+                                                layer_p->top + layer_p->tileRows * 8 - 1));
+}
+
+// Blank layers and cleared statistics
+void Parallax_init(Parallax* parallax_p) {
+  Parallax_forget(parallax_p);
+  parallax_p->nextColumn = 0;
+  parallax_p->frameBytes = 0;
+  parallax_p->peakBytes = 0;
+  parallax_p->deferred = 0;
+}
+
+// The screen was cleared: every layer column is blank
+void Parallax_forget(Parallax* parallax_p) {
+  int l, x;
+
+  for (l = 0; l < PARALLAX_LAYERS; l++) {
+    for (x = 0; x < PARALLAX_WIDTH; x++) {
+      parallax_p->shownColumn[l][x] = -1;
+    }
+  }
+}
+
+// Compare every screen column with what it should show now. A column whose
+// pixels are the same only has its map column updated; the rest are marked
+// in runs while the budget lasts. The scan starts where the last one ran
+// out, so the columns left behind are first in line.
+int Parallax_update(Parallax* parallax_p, int32_t scroll, Sprites* sprites_p, int budget) {
+  int used = 0;
+  int runs = 0;
+  int deferred = 0;
+  int firstDeferred = -1;
+  int start = parallax_p->nextColumn;
+  int l, i;
+
+  for (l = 0; l < PARALLAX_LAYERS; l++) {
+    const ParallaxLayer* layer_p = &layers[l];
+    int16_t* shown = parallax_p->shownColumn[l];
+    int columnBytes = layer_p->tileRows * 8 * 2;
+    int wrap = layer_p->mapWidth * 8 - 1;
+    int offset = (int)((scroll >> layer_p->rateShift) & wrap);
+    int runStart = 0;
+    int runEnd = 0;  // an empty run
+
+    for (i = 0; i < PARALLAX_WIDTH; i++) {
+      int x = (start + i) & (PARALLAX_WIDTH - 1);
+      int column = (offset + x) & wrap;
+
+      // A run can't wrap from the right edge to the left
+      if (x == 0 && runStart < runEnd) {
+        markRun(sprites_p, layer_p, runStart, runEnd - 1);
+        runEnd = runStart;
+      }
+      if (shown[x] == column) {
+        continue;
+      }
+      if (columnBits(layer_p, shown[x]) == columnBits(layer_p, column)) {
+        shown[x] = column;
+        continue;
+      }
+
+      bool extends = runStart < runEnd && x == runEnd;
+      int cost = columnBytes + (extends ? 0 : PARALLAX_WINDOW_BYTES);
+      if (budget >= 0 && (used + cost > budget || (!extends && runs == PARALLAX_MAX_RUNS))) {
+        if (firstDeferred < 0) {
+          firstDeferred = x;
+        }
+        deferred++;
+        continue;
+      }
+
+      if (!extends) {
+        if (runStart < runEnd) {
+          markRun(sprites_p, layer_p, runStart, runEnd - 1);
+        }
+        runStart = x;
+        runs++;
+      }
+      runEnd = x + 1;
+      used += cost;
+      shown[x] = column;
+    }
+    if (runStart < runEnd) {
+      markRun(sprites_p, layer_p, runStart, runEnd - 1);
+    }
+  }
+
+  if (budget >= 0) {
+    parallax_p->frameBytes = used;
+    if (used > parallax_p->peakBytes) {
+      parallax_p->peakBytes = used;
+    }
+    parallax_p->deferred = deferred;
+    if (firstDeferred >= 0) {
+      parallax_p->nextColumn = firstDeferred;
+    }
+  }
+  return used;
+}
+
+// Paint row y as the layers show it now
+bool Parallax_paintRow(const Parallax* parallax_p, int y, int x1, int x2, uint16_t* row) {
+  int l, x;
+
+  for (l = 0; l < PARALLAX_LAYERS; l++) {
+    const ParallaxLayer* layer_p = &layers[l];
+    int band = y - layer_p->top;
+    if (band < 0 || band >= layer_p->tileRows * 8) {
+      continue;
+    }
+
+    const uint8_t* mapRow = layer_p->map + (band >> 3) * layer_p->mapWidth;
+    uint16_t pixel = GFX_toPixel(layer_p->color);
+    for (x = x1; x <= x2; x++) {
+      int column = parallax_p->shownColumn[l][x];
+      bool set = column >= 0 && (tiles[mapRow[column >> 3]][column & 7] >> (band & 7)) & 1;
+      row[x] = set ? pixel : 0;
+    }
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,61 @@
+// Parallax.h - Scrolling background layers behind the runner
+//
+// Each layer is a band of screen rows drawn from a tile map in flash and
+// scrolls at the floor's speed shifted right by its rate, so farther layers
+// move slower. Tiles are 8x8, one bit per pixel, stored a column per byte
+// with bit 0 at the top; a set bit is the layer's color and a clear one the
+// black background. Maps wrap around horizontally.
+//
+// The layer remembers which map column every screen column shows. After a
+// scroll only the columns whose pixels differ are marked for the sprite
+// layer to repaint, in runs of neighbouring columns, and the marks of one
+// update never cost more than a byte budget on the SPI bus: a column that
+// does not fit keeps its old pixels until a later update gets to it. A
+// one-pixel step of both layers costs about 3.4 KB, so the budget spreads
+// the frames where both move over two.
+
+#ifndef PARALLAX_H_
+#define PARALLAX_H_
+
+#include <Sprites.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PARALLAX_LAYERS 2
+#define PARALLAX_WIDTH 128
+
+// LCD bytes one update may mark for repainting, and the cost of opening a
+// window: column and row address commands with four bytes each, then the
+// memory write command
+#define PARALLAX_BUDGET_BYTES 2048
+#define PARALLAX_WINDOW_BYTES 11
+// Runs one update may mark, leaving the sprite layer room to keep each in
+// a window of its own rather than merge them into bigger ones
+#define PARALLAX_MAX_RUNS 24
+// Budget for redrawing a cleared screen in one go
+#define PARALLAX_NO_BUDGET (-1)
+
+typedef struct {
+  int16_t shownColumn[PARALLAX_LAYERS][PARALLAX_WIDTH];  // map column; -1 if blank
+  int nextColumn;   // where the next update starts looking, so none starve
+  int frameBytes;   // marked by the last budgeted update
+  int peakBytes;    // most marked by one budgeted update
+  int deferred;     // columns the last update left for later
+} Parallax;
+
+// Blank layers and cleared statistics
+void Parallax_init(Parallax* parallax_p);
+
+// The screen was cleared: every layer column is blank
+void Parallax_forget(Parallax* parallax_p);
+
+// Bring the layers to floor scroll position scroll, marking changed columns
+// in sprites_p within budget bytes (PARALLAX_NO_BUDGET for no limit).
+// Returns the bytes marked.
+int Parallax_update(Parallax* parallax_p, int32_t scroll, Sprites* sprites_p, int budget);
+
+// Paint row y from x1 to x2 as the layers show it; false if no layer
+// covers row y, leaving row alone
+bool Parallax_paintRow(const Parallax* parallax_p, int y, int x1, int x2, uint16_t* row);
+
+#endif /* PARALLAX_H_ */
@@ -0,0 +1,56 @@
+// Physics.c - Fixed-point jump and fall motion for the player
+
+#include <Physics.h>
+
+// Stand the player on the floor
+void Physics_init(Physics* physics_p, int groundY) {
+  physics_p->groundY = FIX16_FROM_INT(groundY);
+  physics_p->y = physics_p->groundY;
+  physics_p->vy = 0;
+  physics_p->onGround = true;
+  physics_p->holdSteps = 0;
+}
+
+// Leave the floor with the jump velocity
+bool Physics_jump(Physics* physics_p) {
+  if (!physics_p->onGround) {
+    return false;
+  }
+
+  physics_p->vy = -PHYSICS_JUMP_VELOCITY;
+  physics_p->onGround = false;
+  physics_p->holdSteps = PHYSICS_HOLD_STEPS;
+  return true;
+}
+
+// Semi-implicit Euler: velocity first, then position with the new velocity
+void Physics_step(Physics* physics_p, bool held, bool hasFloor) {
+  if (physics_p->onGround) {
+    if (hasFloor) {
+      return;
+    }
+    physics_p->onGround = false;
+  }
+
+  // Letting go ends the light gravity for the rest of the jump
+  Fix16 gravity = PHYSICS_GRAVITY;
+  if (!held) {
+    physics_p->holdSteps = 0;
+  } else if (physics_p->holdSteps > 0 && physics_p->vy < 0) {
+    gravity = PHYSICS_HELD_GRAVITY;
+    physics_p->holdSteps--;
+  }
+
+  physics_p->vy += gravity;
+  if (physics_p->vy > PHYSICS_MAX_FALL_VELOCITY) {
+    physics_p->vy = PHYSICS_MAX_FALL_VELOCITY;
+  }
+  physics_p->y += physics_p->vy;
+
+  // Land on the floor on the way down
+  if (hasFloor && physics_p->vy > 0 && physics_p->y >= physics_p->groundY) {
+    physics_p->y = physics_p->groundY;
+    physics_p->vy = 0;
+    physics_p->onGround = true;
+  }
+}
@@ -0,0 +1,63 @@
+// Physics.h - Fixed-point jump and fall motion for the player
+//
+// Positions and velocities are Q16.16 fixed point: the top 16 bits are
+// whole pixels and the low 16 bits the fraction, so a slow velocity still
+// moves the player a pixel every few steps instead of rounding to nothing.
+// Motion is integrated on a fixed step of PHYSICS_STEP_MS, however fast or
+// slow the game loop runs; the caller runs as many steps as time has
+// passed. y grows downward, as on the screen.
+//
+// Holding the jump button lightens gravity while the player rises, for up
+// to PHYSICS_HOLD_STEPS, so a tap gives a short hop and a long press a
+// high one.
+
+#ifndef PHYSICS_H_
+#define PHYSICS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef int32_t Fix16;
+
+#define FIX16_ONE 65536
+// Whole pixels to Q16.16, and Q16.16 to the nearest whole pixel
+#define FIX16_FROM_INT(n) ((Fix16)(n) * FIX16_ONE)
+#define FIX16_ROUND(f) (((f) + FIX16_ONE / 2) >> 16)
+
+#define PHYSICS_STEP_MS 5
+
+// Per step, in pixels per step (velocity) and pixels per step per step
+// (gravity). A tap rises about 20 pixels, a full hold about 34.
+#define PHYSICS_JUMP_VELOCITY FIX16_ONE
+#define PHYSICS_GRAVITY (FIX16_ONE / 40)
+#define PHYSICS_HELD_GRAVITY (FIX16_ONE / 120)
+#define PHYSICS_HOLD_STEPS 24
+#define PHYSICS_MAX_FALL_VELOCITY (3 * FIX16_ONE)
+
+// A step can run late; this many at most are caught up in one go
+#define PHYSICS_MAX_CATCH_UP 8
+
+typedef struct {
+  Fix16 y;
+  Fix16 vy;
+  Fix16 groundY;  // y the player stands at on the floor
+  bool onGround;
+  int holdSteps;  // steps of light gravity left in this jump
+} Physics;
+
+// Stand the player on the floor at pixel row groundY
+void Physics_init(Physics* physics_p, int groundY);
+
+// Leave the floor; returns false if the player is in the air already
+bool Physics_jump(Physics* physics_p);
+
+// Advance one step. held is whether the jump button is down; with
+// hasFloor false the player falls through the floor.
+void Physics_step(Physics* physics_p, bool held, bool hasFloor);
+
+// The pixel row the player is drawn at
+static inline int Physics_pixelY(const Physics* physics_p) {
+  return FIX16_ROUND(physics_p->y);
+}
+
+#endif /* PHYSICS_H_ */
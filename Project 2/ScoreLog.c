@@ -0,0 +1,200 @@
+// ScoreLog.c - High scores kept in flash as an append-only log
+
+#include <ScoreLog.h>
+#include <stddef.h>
+#include <string.h>
+
+#define SCORELOG_MAGIC 0x53434F52  // "SCOR"
+#define RECORD_SCORE 0x5C
+
+// First bytes of a sector in use. Flash is programmed in address order,
+// so the CRC at the end is the last part of a header or record written.
+typedef struct {
+  uint32_t magic;
+  uint16_t generation;
+  uint16_t unused;
+  uint32_t crc;
+} SectorHeader;
+
+// One saved score
+typedef struct {
+  uint8_t kind;  // RECORD_SCORE; 0xFF means the slot is still erased
+  uint8_t unused[3];
+  int32_t score;
+  uint32_t crc;
+} ScoreRecord;
+
+// CRC-32 (the zlib one), bit at a time; the log checks a few bytes per save
+static uint32_t crc32(const void* data, int length) {
+  const uint8_t* bytes = data;
+  uint32_t crc = 0xFFFFFFFF;
+  int bit;
+
+  while (length-- > 0) {
+    crc ^= *bytes++;
+    for (bit = 0; bit < 8; bit++) {
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+    }
+  }
+  return ~crc;
+}
+
+static uint32_t headerCrc(const SectorHeader* header_p) {
+  return crc32(header_p, offsetof(SectorHeader, crc));
+}
+
+static uint32_t recordCrc(const ScoreRecord* record_p) {
+  return crc32(record_p, offsetof(ScoreRecord, crc));
+}
+
+static bool isErased(const uint8_t* data, int length) {
+  while (length-- > 0) {
+    if (*data++ != 0xFF) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether score a ranks above score b
+static bool isBetter(const ScoreLog* log_p, int32_t a, int32_t b) {
+  return log_p->lowerIsBetter ? a < b : a > b;
+}
+
+// Put score into the RAM table; returns false if it does not rank
+static bool insert(ScoreLog* log_p, int32_t score) {
+  int i = log_p->count;
+
+  if (i == SCORELOG_TABLE_SIZE) {
+    if (!isBetter(log_p, score, log_p->best[i - 1])) {
+      return false;
+    }
+    i--;
+  } else {
+    log_p->count++;
+  }
+
+  // Shift worse scores down; equal scores keep their order
+  while (i > 0 && isBetter(log_p, score, log_p->best[i - 1])) {
+    log_p->best[i] = log_p->best[i - 1];
+    i--;
+  }
+  log_p->best[i] = score;
+  return true;
+}
+
+// Whether sector index starts with a valid header
+static bool readHeader(int index, SectorHeader* header_p) {
+  memcpy(header_p, ScoreFlash_sector(index), sizeof(SectorHeader));
+  return header_p->magic == SCORELOG_MAGIC && header_p->crc == headerCrc(header_p);
+}
+
+// Find the newest valid sector and rebuild the table from it
+void ScoreLog_open(ScoreLog* log_p, bool lowerIsBetter) {
+  SectorHeader headers[SCOREFLASH_SECTORS];
+  int i;
+
+  log_p->lowerIsBetter = lowerIsBetter;
+  log_p->count = 0;
+  log_p->active = -1;
+  log_p->generation = 0;
+  log_p->next = SCOREFLASH_SECTOR_SIZE;
+
+  for (i = 0; i < SCOREFLASH_SECTORS; i++) {
+    if (!readHeader(i, &headers[i])) {
+      continue;
+    }
+    // Generations wrap, so compare the difference
+    if (log_p->active < 0 || (int16_t)(headers[i].generation - log_p->generation) > 0) {
+      log_p->active = i;
+      log_p->generation = headers[i].generation;
+    }
+  }
+  if (log_p->active < 0) {
+    return;
+  }
+
+  // Replay records up to the first erased slot; torn ones fail the CRC
+  const uint8_t* sector = ScoreFlash_sector(log_p->active);
+  int offset;
+  for (offset = sizeof(SectorHeader);
+       offset + (int)sizeof(ScoreRecord) <= SCOREFLASH_SECTOR_SIZE;
+       offset += sizeof(ScoreRecord)) {
+    ScoreRecord record;
+    memcpy(&record, sector + offset, sizeof(record));
+
+    if (isErased((const uint8_t*)&record, sizeof(record))) {
+      break;
+    }
+    if (record.kind == RECORD_SCORE && record.crc == recordCrc(&record)) {
+      insert(log_p, record.score);
+    }
+  }
+  log_p->next = offset;
+}
+
+static bool writeRecord(int index, int offset, int32_t score) {
+  ScoreRecord record;
+  record.kind = RECORD_SCORE;
+  memset(record.unused, 0xFF, sizeof(record.unused));
+  record.score = score;
+  record.crc = recordCrc(&record);
+  return ScoreFlash_program(index, offset, &record, sizeof(record));
+}
+
+// Copy the table into the other sector and switch to it. The header goes
+// last, so until it is written the old sector is still the log.
+static bool compact(ScoreLog* log_p) {
+  int target = log_p->active < 0 ? 0 : 1 - log_p->active;
+  int offset = sizeof(SectorHeader);
+  int i;
+
+  if (!isErased(ScoreFlash_sector(target), SCOREFLASH_SECTOR_SIZE) &&
+      !ScoreFlash_erase(target)) {
+    return false;
+  }
+
+  for (i = 0; i < log_p->count; i++) {
+    if (!writeRecord(target, offset, log_p->best[i])) {
+      return false;
+    }
+    offset += sizeof(ScoreRecord);
+  }
+
+  SectorHeader header;
+  header.magic = SCORELOG_MAGIC;
+  header.generation = log_p->active < 0 ? 1 : log_p->generation + 1;
+  header.unused = 0xFFFF;
+  header.crc = headerCrc(&header);
+  if (!ScoreFlash_program(target, 0, &header, sizeof(header))) {
+    return false;
+  }
+
+  log_p->active = target;
+  log_p->generation = header.generation;
+  log_p->next = offset;
+  return true;
+}
+
+// Offer a score; those that make the table are appended to flash
+bool ScoreLog_add(ScoreLog* log_p, int32_t score) {
+  if (!insert(log_p, score)) {
+    return false;
+  }
+
+  // A full (or missing) sector is compacted, which already saves the new
+  // table, score included
+  if (log_p->active < 0 ||
+      log_p->next + (int)sizeof(ScoreRecord) > SCOREFLASH_SECTOR_SIZE) {
+    compact(log_p);
+    return true;
+  }
+
+  // A failed write that touched the slot still uses it up, since those
+  // bytes cannot be programmed again until the next erase
+  writeRecord(log_p->active, log_p->next, score);
+  if (!isErased(ScoreFlash_sector(log_p->active) + log_p->next, sizeof(ScoreRecord))) {
+    log_p->next += sizeof(ScoreRecord);
+  }
+  return true;
+}
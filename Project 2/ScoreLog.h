@@ -0,0 +1,42 @@
+// ScoreLog.h - High scores kept in flash as an append-only log
+//
+// Each score that makes the table is appended to the active flash sector
+// as one 12-byte record, a single short program operation. When the sector
+// is full, the current table is copied into the other sector, and that
+// sector's header is written last. An erase happens only at that point,
+// and the two sectors take turns, which spreads the wear.
+//
+// Records and headers carry a CRC-32. A record cut short by a power loss
+// fails its check and is skipped. A compaction cut short leaves the new
+// sector without a valid header, so the old one stays active. Opening the
+// log replays the valid records of the active sector into the table.
+
+#ifndef SCORELOG_H_
+#define SCORELOG_H_
+
+#include <HAL/ScoreFlash.h>
+
+// Scores kept in the table
+#define SCORELOG_TABLE_SIZE 5
+
+typedef struct {
+  bool lowerIsBetter;
+
+  // Best scores first; count of them filled
+  int32_t best[SCORELOG_TABLE_SIZE];
+  int count;
+
+  int active;           // sector holding the log, or -1 if none is valid
+  uint16_t generation;  // of the active sector; the newer sector wins
+  int next;             // offset of the first erased record slot
+} ScoreLog;
+
+// Find the newest valid sector and rebuild the table from it. A blank or
+// corrupt flash gives an empty table; the first save formats a sector.
+void ScoreLog_open(ScoreLog* log_p, bool lowerIsBetter);
+
+// Offer a score. Returns true if it made the table; only those scores are
+// saved to flash.
+bool ScoreLog_add(ScoreLog* log_p, int32_t score);
+
+#endif /* SCORELOG_H_ */
@@ -0,0 +1,199 @@
+// Sprites.c - Sprite layer with dirty-rectangle compositing
+
+#include <Sprites.h>
+
+static const SpriteRect emptyRect = {0, 0, -1, -1};
+
+static int min(int a, int b) {
+  return a < b ? a : b;
+}
+
+static int max(int a, int b) {
+  return a > b ? a : b;
+}
+
+static SpriteRect unite(SpriteRect a, SpriteRect b) {
+  if (SpriteRect_isEmpty(a)) {
+    return b;
+  }
+  if (SpriteRect_isEmpty(b)) {
+    return a;
+  }
+  return SpriteRect_make(min(a.x1, b.x1), min(a.y1, b.y1), max(a.x2, b.x2), max(a.y2, b.y2));
+}
+
+static SpriteRect intersect(SpriteRect a, SpriteRect b) {
+  return SpriteRect_make(max(a.x1, b.x1), max(a.y1, b.y1), min(a.x2, b.x2), min(a.y2, b.y2));
+}
+
+// Whether a and b overlap or share an edge, so one window could cover both
+static bool touches(SpriteRect a, SpriteRect b) {
+  return a.x1 <= b.x2 + 1 && b.x1 <= a.x2 + 1 && a.y1 <= b.y2 + 1 && b.y1 <= a.y2 + 1;
+}
+
+static int area(SpriteRect rect) {
+  return (rect.x2 - rect.x1 + 1) * (rect.y2 - rect.y1 + 1);
+}
+
+// Whether one window over both paints no more pixels than two windows would
+static bool mergeable(SpriteRect a, SpriteRect b) {
+  return touches(a, b) && area(unite(a, b)) <= area(a) + area(b);
+}
+
+static bool contains(SpriteRect outer, SpriteRect inner) {
+  return inner.x1 >= outer.x1 && inner.x2 <= outer.x2 && inner.y1 >= outer.y1 &&
+         inner.y2 <= outer.y2;
+}
+
+// No sprites and nothing to repaint
+void Sprites_init(Sprites* sprites_p, SpriteBackground background, const void* data_p) {
+  sprites_p->count = 0;
+  sprites_p->background = background;
+  sprites_p->backgroundData_p = data_p;
+  sprites_p->dirtyCount = 0;
+}
+
+// Set up a sprite covering rect, not yet shown
+void Sprite_init(Sprite* sprite_p, SpriteRect rect, SpritePaintRow paintRow, SpriteDraw draw,
+                 const void* data_p) {
+  sprite_p->rect = rect;
+  sprite_p->shown = emptyRect;
+  sprite_p->visible = true;
+  sprite_p->paintRow = paintRow;
+  sprite_p->draw = draw;
+  sprite_p->data_p = data_p;
+}
+
+// Add a sprite on top of those added before it
+void Sprites_add(Sprites* sprites_p, Sprite* sprite_p) {
+  if (sprites_p->count < SPRITES_MAX) {
+    sprites_p->sprites[sprites_p->count++] = sprite_p;
+    Sprites_invalidate(sprites_p, sprite_p->rect);
+  }
+}
+
+// Mark the rectangle last shown and the new one together
+void Sprites_update(Sprites* sprites_p, Sprite* sprite_p, SpriteRect rect) {
+  sprite_p->rect = rect;
+  Sprites_invalidate(sprites_p, unite(sprite_p->shown, rect));
+}
+
+// The mark that grows least by taking in rect
+static int smallestGrowth(const Sprites* sprites_p, SpriteRect rect) {
+  int best = 0;
+  int bestGrowth = 0;
+  int i;
+
+  for (i = 0; i < sprites_p->dirtyCount; i++) {
+    int growth = area(unite(sprites_p->dirty[i], rect)) - area(sprites_p->dirty[i]);
+    if (i == 0 || growth < bestGrowth) {
+      best = i;
+      bestGrowth = growth;
+    }
+  }
+  return best;
+}
+
+// Repaint rect at the next flush. It joins every mark it can share a window
+// with for free; a full list folds it into the mark that grows least, so
+// more is repainted, never less.
+void Sprites_invalidate(Sprites* sprites_p, SpriteRect rect) {
+  rect = intersect(rect, SpriteRect_make(0, 0, SPRITES_SCREEN_SIZE - 1, SPRITES_SCREEN_SIZE - 1));
+  if (SpriteRect_isEmpty(rect)) {
+    return;
+  }
+
+  // A merge can make the mark fit ones it missed before, so go again
+  int i = 0;
+  while (i < sprites_p->dirtyCount) {
+    if (mergeable(sprites_p->dirty[i], rect)) {
+      rect = unite(rect, sprites_p->dirty[i]);
+      sprites_p->dirty[i] = sprites_p->dirty[--sprites_p->dirtyCount];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+
+  if (sprites_p->dirtyCount == SPRITES_MAX_DIRTY) {
+    i = smallestGrowth(sprites_p, rect);
+    sprites_p->dirty[i] = unite(sprites_p->dirty[i], rect);
+  } else {
+    sprites_p->dirty[sprites_p->dirtyCount++] = rect;
+  }
+}
+
+// The screen was cleared: every sprite is painted afresh at the next flush
+void Sprites_forget(Sprites* sprites_p) {
+  int i;
+
+  sprites_p->dirtyCount = 0;
+  for (i = 0; i < sprites_p->count; i++) {
+    sprites_p->sprites[i]->shown = emptyRect;
+    Sprites_invalidate(sprites_p, sprites_p->sprites[i]->rect);
+  }
+}
+
+// The row being painted; a screen width is too much for the stack
+static uint16_t row[SPRITES_SCREEN_SIZE];
+
+// One window for the whole rectangle, filled row by row
+static void paint(Sprites* sprites_p, SpriteRect rect, GFX* gfx_p) {
+  int y, i;
+
+  GFX_startWindow(gfx_p, rect.x1, rect.y1, rect.x2, rect.y2);
+  for (y = rect.y1; y <= rect.y2; y++) {
+    sprites_p->background(sprites_p->backgroundData_p, y, rect.x1, rect.x2, row);
+
+    for (i = 0; i < sprites_p->count; i++) {
+      const Sprite* sprite_p = sprites_p->sprites[i];
+      if (!sprite_p->visible || sprite_p->draw || y < sprite_p->rect.y1 || y > sprite_p->rect.y2) {
+        continue;
+      }
+      int x1 = max(rect.x1, sprite_p->rect.x1);
+      int x2 = min(rect.x2, sprite_p->rect.x2);
+      if (x1 <= x2) {
+        sprite_p->paintRow(sprite_p, y, x1, x2, row);
+      }
+    }
+
+    GFX_writePixels(gfx_p, row + rect.x1, rect.x2 - rect.x1 + 1);
+  }
+}
+
+// Repaint every mark. A mark inside a drawn sprite needs only that sprite,
+// which covers it completely.
+void Sprites_flush(Sprites* sprites_p, GFX* gfx_p) {
+  int d, i;
+
+  for (d = 0; d < sprites_p->dirtyCount; d++) {
+    SpriteRect rect = sprites_p->dirty[d];
+    bool covered = false;
+
+    for (i = 0; i < sprites_p->count; i++) {
+      const Sprite* sprite_p = sprites_p->sprites[i];
+      if (sprite_p->visible && sprite_p->draw && contains(sprite_p->rect, rect)) {
+        covered = true;
+      }
+    }
+    if (!covered) {
+      paint(sprites_p, rect, gfx_p);
+    }
+
+    // Drawn sprites go over what was painted; one touching two marks is
+    // drawn twice, which is rare and cheaper than tracking it
+    for (i = 0; i < sprites_p->count; i++) {
+      const Sprite* sprite_p = sprites_p->sprites[i];
+      if (sprite_p->visible && sprite_p->draw &&
+          !SpriteRect_isEmpty(intersect(sprite_p->rect, rect))) {
+        sprite_p->draw(sprite_p, gfx_p);
+      }
+    }
+  }
+
+  for (i = 0; i < sprites_p->count; i++) {
+    Sprite* sprite_p = sprites_p->sprites[i];
+    sprite_p->shown = sprite_p->visible ? sprite_p->rect : emptyRect;
+  }
+  sprites_p->dirtyCount = 0;
+}
@@ -0,0 +1,93 @@
+// Sprites.h - Sprite layer with dirty-rectangle compositing
+//
+// The player, color wheel and score are sprites: rectangles on the screen
+// that paint their own pixels. Moving or changing a sprite marks the
+// rectangle it was last shown in together with the one it covers now.
+// Sprites_flush merges the marks and repaints each merged rectangle once,
+// background first and then every sprite in the order they were added, as
+// a single window write to the LCD. Nothing is erased by drawing black over
+// it, so what lies under a sprite comes back as it was.
+//
+// A sprite paints one row at a time into a row of LCD pixels. Text is
+// drawn by grlib instead; a sprite with a draw function is drawn on top
+// after the rectangle is written, and must cover its whole rectangle.
+
+#ifndef SPRITES_H_
+#define SPRITES_H_
+
+#include <HAL/Graphics.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SPRITES_MAX 8
+// Enough for a frame of background column runs without merging them
+#define SPRITES_MAX_DIRTY 32
+#define SPRITES_SCREEN_SIZE 128
+
+// Inclusive corners; empty when x2 < x1
+typedef struct {
+  int x1, y1, x2, y2;
+} SpriteRect;
+
+typedef struct _Sprite Sprite;
+
+// Puts the colors of row y, columns x1 to x2, into row[x1..x2]. Pixels the
+// sprite does not cover are left as they are.
+typedef void (*SpritePaintRow)(const Sprite* sprite_p, int y, int x1, int x2, uint16_t* row);
+
+// Draws the whole sprite straight to the screen
+typedef void (*SpriteDraw)(const Sprite* sprite_p, GFX* gfx_p);
+
+struct _Sprite {
+  SpriteRect rect;
+  SpriteRect shown;  // where it was last painted; empty if nowhere
+  bool visible;
+  SpritePaintRow paintRow;
+  SpriteDraw draw;  // drawn on top instead of painted, when set
+  const void* data_p;
+};
+
+// Colors of row y under every sprite
+typedef void (*SpriteBackground)(const void* data_p, int y, int x1, int x2, uint16_t* row);
+
+typedef struct {
+  Sprite* sprites[SPRITES_MAX];
+  int count;
+  SpriteBackground background;
+  const void* backgroundData_p;
+  SpriteRect dirty[SPRITES_MAX_DIRTY];
+  int dirtyCount;
+} Sprites;
+
+// No sprites and nothing to repaint
+void Sprites_init(Sprites* sprites_p, SpriteBackground background, const void* data_p);
+
+// Set up a sprite covering rect, not yet shown
+void Sprite_init(Sprite* sprite_p, SpriteRect rect, SpritePaintRow paintRow, SpriteDraw draw,
+                 const void* data_p);
+
+// Add a sprite on top of those added before it
+void Sprites_add(Sprites* sprites_p, Sprite* sprite_p);
+
+// The sprite moved to rect, changed how it looks, or was shown or hidden
+void Sprites_update(Sprites* sprites_p, Sprite* sprite_p, SpriteRect rect);
+
+// Repaint rect at the next flush, sprites and background alike
+void Sprites_invalidate(Sprites* sprites_p, SpriteRect rect);
+
+// The screen was cleared: no sprite is on it any more
+void Sprites_forget(Sprites* sprites_p);
+
+// Repaint everything marked since the last flush
+void Sprites_flush(Sprites* sprites_p, GFX* gfx_p);
+
+static inline SpriteRect SpriteRect_make(int x1, int y1, int x2, int y2) {
+  SpriteRect rect = {x1, y1, x2, y2};
+  return rect;
+}
+
+static inline bool SpriteRect_isEmpty(SpriteRect rect) {
+  return rect.x2 < rect.x1 || rect.y2 < rect.y1;
+}
+
+#endif /* SPRITES_H_ */
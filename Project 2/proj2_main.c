@@ -1,14 +1,17 @@
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <time.h>
 #include <Application.h>
+#include <Difficulty.h>
+#include <HAL/Format.h>
 #include <HAL/HAL.h>
+#include <HAL/Random.h>
 #include <HAL/Timer.h>
 #include <HAL/Graphics.h>
+#include <ScoreLog.h>
+#include <Sprites.h>
 
 static void InitNonBlockingLED(void)
 {
@@ -25,14 +28,18 @@ static void PollNonBlockingLED(void)
     }
 }
 
+// Too big for the 512-byte stack, so it lives in static memory.
+static Application app;
+
 int main(void)
 {
     WDT_A_holdTimer();
     InitSystemTiming();
+    // Seeded before the joystick takes over the ADC.
+    uint32_t seed = Random_bootSeed();
     HAL hal = HAL_construct();
-    Application app = Application_construct();
+    Application_init(&app, seed);
     InitNonBlockingLED();
-    srand((unsigned) time(NULL));
 
     while (true)
     {
@@ -42,53 +49,60 @@ int main(void)
     }
 }
 
-// Constructs and initializes the Application structure with starting values.
-Application Application_construct(void)
+// High scores, saved in flash so they survive a reset.
+static ScoreLog scoreLog;
+
+// The wheel's colors as a game first deals them, center first. A floor with
+// fewer colors uses the first ones of this list.
+static const uint32_t wheelColors[DIFFICULTY_MAX_COLORS] =
+{
+    0xFFFFFF, 0x00FF00, 0x0000FF, 0xFFFF00, 0xFF00FF
+};
+
+// Initializes the Application structure in place with starting values.
+void Application_init(Application* app_p, uint32_t seed)
 {
-    Application app;
+    // Floor layout and colors draw from separate streams of the boot seed.
+    Random_init(&app_p->floorRandom, seed, RANDOM_STREAM_FLOOR);
+    Random_init(&app_p->colorRandom, seed, RANDOM_STREAM_COLORS);
     // Initialize game parameters.
-    app.jumpHeight = 25;
-    app.playerRadius = 5;
-    app.playerCenterX = 10;
-    app.playerJumpDelay = 1.5;
-    app.maxHighScores = 5;
-    app.difficulty = 0;
-
-    // Allocate memory for high score array and initialize scores to zero.
-    app.highScores = malloc(app.maxHighScores * sizeof(int));
-    int i;
-    for (i = 0; i < app.maxHighScores; i++)
-        app.highScores[i] = 0;
+    app_p->playerRadius = 5;
+    app_p->playerCenterX = 10;
+    app_p->difficulty = 0;
+
+    // Allocate memory for high score array and fill it from the flash log.
+    app_p->maxHighScores = SCORELOG_TABLE_SIZE;
+    app_p->highScores = malloc(app_p->maxHighScores * sizeof(int));
+    ScoreLog_open(&scoreLog, false);
+    loadHighScores(app_p);
 
     // Set initial game state and screen flags.
-    app.state = STATE_TITLE;
-    app.titleScreenShown = false;
-    app.screenNeedsRedraw = true;
-    app.joystickCentered = true;
-    app.arrow = CURSOR_0;
-    app.titleTimer = SWTimer_construct(3000); // Title screen display timer.
-    app.playerY = 100; // Starting Y position for the player.
-    app.lastPlayerY = app.playerY;
-    app.jumpState = JUMP_NONE; // No jump in progress.
-    app.jumpProgress = 0;
-    app.isOnGround = true;
-    app.jumpTimer = SWTimer_construct(app.playerJumpDelay); // Timer for jump progress.
-    app.scoreTimer = SWTimer_construct(1000); // Score update interval.
-    app.score = 0;
-    app.fallTimer = SWTimer_construct(10); // Timer controlling falling speed.
+    app_p->state = STATE_TITLE;
+    app_p->titleScreenShown = false;
+    app_p->screenNeedsRedraw = true;
+    app_p->arrow = CURSOR_0;
+    app_p->titleTimer = SWTimer_construct(3000); // Title screen display timer.
+    // The player starts standing on the floor.
+    Physics_init(&app_p->playerPhysics, FLOOR_SCREEN_Y - app_p->playerRadius);
+    app_p->playerY = Physics_pixelY(&app_p->playerPhysics);
+    app_p->physicsTimer = SWTimer_construct(PHYSICS_STEP_MS); // Fixed physics step.
+    app_p->scoreTimer = SWTimer_construct(1000); // Score update interval.
+    app_p->score = 0;
 
     // Initialize color wheel with preset colors.
-    app.colorWheel.center = 0xFFFFFF;
-    app.colorWheel.up     = 0x00FF00;
-    app.colorWheel.down   = 0x0000FF;
-    app.colorWheel.left   = 0xFFFF00;
-    app.colorWheel.right  = 0xFF00FF;
-
-    app.isFalling = false;
-    initFloor(&app); // Initialize the floor segments for the game.
-    app.floorTimer = SWTimer_construct(5);
-    SWTimer_start(&app.floorTimer);
-    return app;
+    app_p->colorWheel.center = wheelColors[0];
+    app_p->colorWheel.up     = wheelColors[1];
+    app_p->colorWheel.down   = wheelColors[2];
+    app_p->colorWheel.left   = wheelColors[3];
+    app_p->colorWheel.right  = wheelColors[4];
+
+    app_p->isFalling = false;
+    initFloor(app_p); // Initialize the floor segments for the game.
+    invalidateFloor(app_p, 0, FLOOR_VIEW_WIDTH - 1); // Nothing is on screen yet.
+    app_p->floorShownScroll = app_p->floor.scroll;
+    Parallax_init(&app_p->parallax);
+    app_p->floorTimer = SWTimer_construct(5);
+    SWTimer_start(&app_p->floorTimer);
 }
 
 // Main loop to update the application state based on the current game state.
@@ -174,24 +188,21 @@ void App_Screen_updatemainmenu(Application* app_p, GFX* gfx_p)
 // Handles user input and selection in the main menu.
 void App_Screen_handlemainmenu(Application* app_p, HAL* hal_p)
 {
-    uint16_t joyY = hal_p->joystick.y;
+    // One step per push, repeating faster while the joystick is held.
+    // A push a little off axis still counts as up or down.
+    JoystickDirection step = Joystick_repeated4(&hal_p->joystick);
     // Move up through menu items.
-    if (joyY > 14000 && app_p->joystickCentered)
+    if (step == JOYSTICK_UP)
     {
         app_p->arrow = (app_p->arrow == CURSOR_0) ? CURSOR_3 : (Cursor)(app_p->arrow - 1);
         App_Screen_updatemainmenu(app_p, &hal_p->gfx);
-        app_p->joystickCentered = false;
     }
     // Move down through menu items.
-    else if (joyY < 2000 && app_p->joystickCentered)
+    else if (step == JOYSTICK_DOWN)
     {
         app_p->arrow = (app_p->arrow == CURSOR_3) ? CURSOR_0 : (Cursor)(app_p->arrow + 1);
         App_Screen_updatemainmenu(app_p, &hal_p->gfx);
-        app_p->joystickCentered = false;
     }
-    // Reset joystick centered flag when joystick is in the center range.
-    if (joyY >= 6000 && joyY <= 10000)
-        app_p->joystickCentered = true;
     // Select menu option on button press.
     if (Button_isTapped(&hal_p->boosterpackS1))
     {
@@ -248,12 +259,15 @@ void App_Screen_showHighScoreScreen(Application* app, GFX* gfx)
 {
     GFX_clear(gfx);
     GFX_print(gfx, "High Scores", 0, 4);
-    char scoreStr[20];
+    char scoreStr[2 * FORMAT_MAX_INT_LEN + 3];
     int i;
     // Loop through and display each high score.
     for (i = 0; i < app->maxHighScores; i++)
     {
-        sprintf(scoreStr, "%d : %d", i + 1, app->highScores[i]);
+        char* p = scoreStr;
+        p += Format_int(p, i + 1, 0, ' ');
+        p += Format_string(p, " : ");
+        Format_int(p, app->highScores[i], 0, ' ');
         GFX_print(gfx, scoreStr, 2 + i, 1);
     }
     GFX_print(gfx, "Press BB1 to return", 8, 1);
@@ -277,12 +291,11 @@ void App_Screen_printDifficulty(Application* app, GFX* gfx)
 
     GFX_setForeground(gfx, 0xFFFFFF);
 
-    if (app->difficulty == 0)
-        GFX_print(gfx, "Difficulty: Easy", 2, 1);
-    else if (app->difficulty == 1)
-        GFX_print(gfx, "Difficulty: Hard", 2, 1);
-    else if (app->difficulty == 2)
-        GFX_print(gfx, "Difficulty: Increase", 2, 1);
+    char line[24];
+    char* p = line;
+    p += Format_string(p, "Difficulty: ");
+    Format_string(p, difficultyModes[app->difficulty].name);
+    GFX_print(gfx, line, 2, 1);
 }
 
 // Handle button input on the options screen to change difficulty or return to menu.
@@ -290,7 +303,7 @@ void App_Screen_handleOptionsScreen(Application* app, HAL* hal)
 {
     if (Button_isTapped(&hal->boosterpackS2))
     {
-        app->difficulty = (app->difficulty + 1) % 3;
+        app->difficulty = (app->difficulty + 1) % difficultyModeCount;
         App_Screen_printDifficulty(app, &hal->gfx);
     }
 
@@ -317,33 +330,20 @@ void App_Screen_handleInstructionsScreen(Application* app, HAL* hal)
 void checkPlayerFloorCollision(Application* app)
 {
     int playerBottomY = app->playerY + app->playerRadius;
-    const int floorTopY = 105;
-    if (!app->isFalling && playerBottomY >= floorTopY && playerBottomY <= (floorTopY + 18))
+    const int floorTopY = FLOOR_SCREEN_Y;
+    if (!app->isFalling && app->playerPhysics.onGround && playerBottomY >= floorTopY &&
+        playerBottomY <= (floorTopY + FLOOR_SCREEN_HEIGHT))
     {
-         int px = app->playerCenterX;
-         int i;
-         // Check collision with each floor segment.
-         for (i = 0; i < app->numFloorSegments; i++)
+         // Check collision with the floor segment under the player.
+         const FloorSegment* seg = Floor_segmentAt(&app->floor, app->playerCenterX);
+         if (seg)
          {
-             FloorSegment seg = app->floorSegments[i];
-             if (px >= seg.x && px < seg.x + seg.width)
-             {
-                 // If player color doesn't match floor segment color, trigger falling.
-                 if (seg.color != app->colorWheel.center)
-                 {
-                     app->isFalling = true;
-                     SWTimer_start(&app->fallTimer);
-                 }
-                 else
-                 {
-                     app->isOnGround = true;
-                 }
-                 return;
-             }
+             // If player color doesn't match floor segment color, trigger falling.
+             // Gaps are drawn in black, which never matches.
+             if (seg->color != app->colorWheel.center)
+                 app->isFalling = true;
          }
     }
-    else
-         app->isOnGround = false;
 }
 
 // Manages the game screen updates: character, floor collisions, score, etc.
@@ -351,15 +351,8 @@ void App_Screen_handleGameScreen(Application* app, HAL* hal)
 {
     if (app->screenNeedsRedraw)
     {
-         GFX_clear(&hal->gfx);
-         char scoreStr[20];
-         sprintf(scoreStr, "Score : %d", app->score);
-         GFX_print(&hal->gfx, scoreStr, 0, 0);
-         drawFloor(app, &hal->gfx);
-         drawColorWheel(&hal->gfx, &app->colorWheel);
-         drawPlayer(app, &hal->gfx, app->playerY, app->colorWheel.center);
+         App_Screen_showGameScreen(app, &hal->gfx);
          app->screenNeedsRedraw = false;
-         app->lastPlayerY = app->playerY;
          return;
     }
     updateCharacter(app, hal);  // Update player character position/jump.
@@ -372,44 +365,153 @@ void App_Screen_handleGameScreen(Application* app, HAL* hal)
          return;
     }
     if (!app->isFalling)
-         drawFloor(app, &hal->gfx); // Continuously redraw floor if player is not falling.
+    {
+         drawFloor(app); // Mark what scrolled if player is not falling.
+         // The background marks only what fits in its share of the frame.
+         Parallax_update(&app->parallax, app->floor.scroll, &app->sprites, PARALLAX_BUDGET_BYTES);
+    }
+    Sprites_flush(&app->sprites, &hal->gfx); // Repaint everything marked this pass.
 }
 
 // Display game screen contents.
 void App_Screen_showGameScreen(Application* app, GFX* gfx)
 {
     GFX_clear(gfx);
-    char scoreStr[20];
-    sprintf(scoreStr, "Score : %d", app->score);
-    GFX_print(gfx, scoreStr, 0, 0);
-    drawFloor(app, gfx);
-    drawColorWheel(gfx, &app->colorWheel);
-    drawPlayer(app, gfx, app->playerY, app->colorWheel.center);
+    GFX_print(gfx, "Score : ", 0, 0);
+    initSprites(app);
+    invalidateFloor(app, 0, FLOOR_VIEW_WIDTH - 1);
+    drawFloor(app);
+    Parallax_forget(&app->parallax);
+    Parallax_update(&app->parallax, app->floor.scroll, &app->sprites, PARALLAX_NO_BUDGET);
+    Sprites_flush(&app->sprites, gfx);
 }
 
 // Resets the game state for a new game round.
 void resetSimpleGame(Application* app, HAL* hal, GFX* gfx)
 {
     app->screenNeedsRedraw = false;
-    app->joystickCentered = true;
-    app->playerY = 100;
-    app->jumpState = JUMP_NONE;
-    app->jumpProgress = 0;
-    app->isOnGround = true;
+    Physics_init(&app->playerPhysics, FLOOR_SCREEN_Y - app->playerRadius);
+    app->playerY = Physics_pixelY(&app->playerPhysics);
+    SWTimer_start(&app->physicsTimer);
     app->score = 0;
     SWTimer_start(&app->scoreTimer); // Restart score timer.
     initFloor(app); // Reinitialize floor segments.
+    Parallax_init(&app->parallax); // Restart the background statistics too.
     App_Screen_showGameScreen(app, gfx);
 }
 
-// Draw the player's character as a solid circle.
-void drawPlayer(Application* app, GFX* gfx, int y, int ignoredColor)
+// The color of a floorShown index.
+static uint32_t floorShownColor(uint8_t shown)
+{
+    return (shown == FLOOR_SHOWN_GAP ? FLOOR_GAP_COLOR : wheelColors[shown]);
+}
+
+// The floorShown index of a segment color: its place in wheelColors, or
+// FLOOR_SHOWN_GAP for the gap color.
+static uint8_t floorShownIndex(uint32_t color)
+{
+    uint8_t i;
+    for (i = 0; i < DIFFICULTY_MAX_COLORS; i++)
+         if (wheelColors[i] == color)
+              return i;
+    return FLOOR_SHOWN_GAP;
+}
+
+// Paints the screen behind the sprites: the floor band and the parallax layers
+// as they are shown, black elsewhere.
+static void paintBackground(const void* data_p, int y, int x1, int x2, uint16_t* row)
+{
+    const Application* app = data_p;
+    int x;
+    if (y >= FLOOR_SCREEN_Y && y < FLOOR_SCREEN_Y + FLOOR_SCREEN_HEIGHT)
+    {
+         for (x = x1; x <= x2; x++)
+         {
+              uint8_t shown = app->floorShown[x];
+              // A column the floor hasn't drawn yet is still clear.
+              row[x] = (shown == FLOOR_UNDRAWN ? 0 : GFX_toPixel(floorShownColor(shown)));
+         }
+    }
+    else if (!Parallax_paintRow(&app->parallax, y, x1, x2, row))
+    {
+         for (x = x1; x <= x2; x++)
+              row[x] = 0;
+    }
+}
+
+// Paints the part of row y inside a filled circle, between x1 and x2.
+static void paintCircle(int y, int x1, int x2, uint16_t* row, int cx, int cy, int r, uint32_t color)
+{
+    int dy = y - cy;
+    if (dy < -r || dy > r)
+         return;
+    // Widest half-span within the circle, rounded like a midpoint circle.
+    int half = 0;
+    while ((half + 1) * (half + 1) + dy * dy <= r * r + r)
+         half++;
+    int from = (cx - half > x1 ? cx - half : x1);
+    int to = (cx + half < x2 ? cx + half : x2);
+    uint16_t pixel = GFX_toPixel(color);
+    for (; from <= to; from++)
+         row[from] = pixel;
+}
+
+// Paints the player's character as a solid circle.
+static void paintPlayer(const Sprite* sprite, int y, int x1, int x2, uint16_t* row)
+{
+    const Application* app = sprite->data_p;
+    paintCircle(y, x1, x2, row, app->playerCenterX, app->playerY, app->playerRadius,
+                app->colorWheel.center);
+}
+
+// Paints the color wheel: the center color with the four it can swap with around it.
+static void paintColorWheel(const Sprite* sprite, int y, int x1, int x2, uint16_t* row)
+{
+    const ColorWheel* cw = sprite->data_p;
+    paintCircle(y, x1, x2, row, 100, 30, 5, cw->center);
+    paintCircle(y, x1, x2, row, 100, 20, 5, cw->up);
+    paintCircle(y, x1, x2, row, 100, 40, 5, cw->down);
+    paintCircle(y, x1, x2, row, 90, 30, 5, cw->left);
+    paintCircle(y, x1, x2, row, 110, 30, 5, cw->right);
+}
+
+// Draws the score after the "Score : " label; text comes from grlib.
+static void drawScore(const Sprite* sprite, GFX* gfx)
+{
+    const Application* app = sprite->data_p;
+    GFX_setForeground(gfx, 0xFFFFFF);
+    GFX_printInt(gfx, app->score, 0, 0, 8);
+}
+
+// The square the player's circle is drawn in.
+static SpriteRect playerRect(const Application* app)
 {
-    GFX_setForeground(gfx, app->colorWheel.center);
-    GFX_drawSolidCircle(gfx, app->playerCenterX, y, app->playerRadius);
+    return SpriteRect_make(app->playerCenterX - app->playerRadius, app->playerY - app->playerRadius,
+                           app->playerCenterX + app->playerRadius, app->playerY + app->playerRadius);
 }
 
-// Update the character position based on jump state and handle drawing.
+// The text cells the score's digits take up, 6x8 pixels each.
+static SpriteRect scoreRect(const Application* app)
+{
+    char text[FORMAT_MAX_INT_LEN];
+    int length = Format_int(text, app->score, 0, ' ');
+    return SpriteRect_make(8 * 6, 0, (8 + length) * 6 - 1, 7);
+}
+
+// Registers the game screen's sprites, bottom layer first, to be painted at the next flush.
+void initSprites(Application* app)
+{
+    Sprites_init(&app->sprites, paintBackground, app);
+    Sprite_init(&app->wheelSprite, SpriteRect_make(85, 15, 115, 45), paintColorWheel, NULL,
+                &app->colorWheel);
+    Sprite_init(&app->playerSprite, playerRect(app), paintPlayer, NULL, app);
+    Sprite_init(&app->scoreSprite, scoreRect(app), NULL, drawScore, app);
+    Sprites_add(&app->sprites, &app->wheelSprite);
+    Sprites_add(&app->sprites, &app->playerSprite);
+    Sprites_add(&app->sprites, &app->scoreSprite);
+}
+
+// Update the character position by running the physics steps that are due.
 void updateCharacter(Application* app, HAL* hal)
 {
     if (app->isFalling)
@@ -418,156 +520,81 @@ void updateCharacter(Application* app, HAL* hal)
         return;
     }
 
-    // Handle jump states: start jump, move up or down.
-    switch (app->jumpState)
-    {
-        case JUMP_NONE:
-            // Start jump if button is tapped and character is on ground.
-            if (Button_isTapped(&hal->boosterpackS1) && app->isOnGround)
-            {
-                app->jumpState = JUMP_UP;
-                app->jumpProgress = 0;
-                app->isOnGround = false;
-                SWTimer_start(&app->jumpTimer);
-            }
-            break;
-
-        case JUMP_UP:
-        case JUMP_DOWN:
-            // Wait for jump timer expiration before updating jump progress.
-            if (!SWTimer_expired(&app->jumpTimer)) break;
-
-            app->lastPlayerY = app->playerY;
+    // Start jump if button is tapped and character is on ground.
+    if (Button_isTapped(&hal->boosterpackS1))
+        Physics_jump(&app->playerPhysics);
 
-            if (app->jumpState == JUMP_UP)
-            {
-                app->playerY -= 1; // Move player up.
-                app->jumpProgress++;
-
-                if (app->jumpProgress >= app->jumpHeight)
-                {
-                    app->jumpState = JUMP_DOWN;
-                    app->jumpProgress = 0;
-                }
-            }
-            else
-            {
-                app->playerY += 1; // Move player down.
-                app->jumpProgress++;
-
-                if (app->jumpProgress >= app->jumpHeight)
-                {
-                    app->jumpState = JUMP_NONE;
-                    app->isOnGround = true;
-                }
-            }
+    // Holding the button for the whole step makes the jump higher.
+    bool held = Button_isPressed(&hal->boosterpackS1);
+    uint32_t steps = SWTimer_takePeriods(&app->physicsTimer);
+    if (steps > PHYSICS_MAX_CATCH_UP)
+        steps = PHYSICS_MAX_CATCH_UP;
+    while (steps-- > 0)
+        Physics_step(&app->playerPhysics, held, true);
 
-            // Erase previous player drawing and redraw at new position.
-            GFX_setForeground(&hal->gfx, 0x000000);
-            GFX_drawSolidCircle(&hal->gfx, app->playerCenterX, app->lastPlayerY, app->playerRadius);
-            drawPlayer(app, &hal->gfx, app->playerY, app->colorWheel.center);
-            SWTimer_start(&app->jumpTimer);
-            break;
+    // Moving the sprite repaints where the player was and where it is now.
+    int y = Physics_pixelY(&app->playerPhysics);
+    if (y != app->playerY)
+    {
+        app->playerY = y;
+        Sprites_update(&app->sprites, &app->playerSprite, playerRect(app));
     }
 }
 
 // Handles the falling state for the player character.
 void handleFalling(Application* app, HAL* hal)
 {
-    if (SWTimer_expired(&app->fallTimer))
-    {
-        app->lastPlayerY = app->playerY;
-        app->playerY += 1; // Increase Y position to simulate falling.
-
-        GFX_setForeground(&hal->gfx, 0x000000);
-        int dx;
-        // Erase the area where the player was previously drawn.
-        for (dx = -app->playerRadius; dx <= app->playerRadius; dx++)
-        {
-            int colX = app->playerCenterX + dx;
-            if (colX >= 0 && colX < 128)
-            {
-                GFX_drawLine(&hal->gfx, colX, app->lastPlayerY - app->playerRadius,
-                             colX, app->playerY + app->playerRadius);
-            }
-        }
-
-        drawPlayer(app, &hal->gfx, app->playerY, app->colorWheel.center);
-        SWTimer_start(&app->fallTimer);
+    // The floor no longer holds the player up.
+    uint32_t steps = SWTimer_takePeriods(&app->physicsTimer);
+    if (steps > PHYSICS_MAX_CATCH_UP)
+        steps = PHYSICS_MAX_CATCH_UP;
+    while (steps-- > 0)
+        Physics_step(&app->playerPhysics, false, false);
+
+    int y = Physics_pixelY(&app->playerPhysics);
+    if (y == app->playerY)
+        return;
+    // The floor behind the player is repainted as it passes.
+    app->playerY = y;
+    Sprites_update(&app->sprites, &app->playerSprite, playerRect(app));
 
-        // Check if player has fallen off screen.
-        if (app->playerY > 128 + app->playerRadius)
-        {
-            app->isFalling = false;
-            endGame(app, hal);
-        }
+    // Check if player has fallen off screen.
+    if (app->playerY > 128 + app->playerRadius)
+    {
+        app->isFalling = false;
+        endGame(app, hal);
     }
 }
 
-// Draw the color wheel on the screen.
-void drawColorWheel(GFX* gfx, ColorWheel* cw)
+// Marks the color wheel for repainting, and the player, whose color is the wheel's center.
+void drawColorWheel(Application* app)
 {
-    GFX_setForeground(gfx, cw->center);
-    GFX_drawSolidCircle(gfx, 100, 30, 5);
-    GFX_setForeground(gfx, cw->up);
-    GFX_drawSolidCircle(gfx, 100, 20, 5);
-    GFX_setForeground(gfx, cw->down);
-    GFX_drawSolidCircle(gfx, 100, 40, 5);
-    GFX_setForeground(gfx, cw->left);
-    GFX_drawSolidCircle(gfx, 90, 30, 5);
-    GFX_setForeground(gfx, cw->right);
-    GFX_drawSolidCircle(gfx, 110, 30, 5);
+    Sprites_update(&app->sprites, &app->wheelSprite, app->wheelSprite.rect);
+    Sprites_update(&app->sprites, &app->playerSprite, playerRect(app));
 }
 
 // Updates the color wheel based on joystick direction input.
+// Each push swaps once; the joystick has to come back to center for the next.
+// A push a little off axis swaps toward its main axis.
 void updateColorWheel(Application* app, HAL* hal)
 {
-    if (hal->joystick.y > 14000 && app->joystickCentered)
-    {
-         // Swap colors for upward joystick motion.
-         int temp = app->colorWheel.center;
-         app->colorWheel.center = app->colorWheel.up;
-         app->colorWheel.up = temp;
-         app->joystickCentered = false;
-         drawColorWheel(&hal->gfx, &app->colorWheel);
-         drawPlayer(app, &hal->gfx, app->playerY, app->colorWheel.center);
-    }
-    else if (hal->joystick.y < 2000 && app->joystickCentered)
-    {
-         // Swap colors for downward joystick motion.
-         int temp = app->colorWheel.center;
-         app->colorWheel.center = app->colorWheel.down;
-         app->colorWheel.down = temp;
-         app->joystickCentered = false;
-         drawColorWheel(&hal->gfx, &app->colorWheel);
-         drawPlayer(app, &hal->gfx, app->playerY, app->colorWheel.center);
-    }
-    else if (hal->joystick.x < 2000 && app->joystickCentered)
-    {
-         // Swap colors for leftward joystick motion.
-         int temp = app->colorWheel.center;
-         app->colorWheel.center = app->colorWheel.left;
-         app->colorWheel.left = temp;
-         app->joystickCentered = false;
-         drawColorWheel(&hal->gfx, &app->colorWheel);
-         drawPlayer(app, &hal->gfx, app->playerY, app->colorWheel.center);
-    }
-    else if (hal->joystick.x > 14000 && app->joystickCentered)
-    {
-         // Swap colors for rightward joystick motion.
-         int temp = app->colorWheel.center;
-         app->colorWheel.center = app->colorWheel.right;
-         app->colorWheel.right = temp;
-         app->joystickCentered = false;
-         drawColorWheel(&hal->gfx, &app->colorWheel);
-         drawPlayer(app, &hal->gfx, app->playerY, app->colorWheel.center);
-    }
-    else if (hal->joystick.x >= 6000 && hal->joystick.x <= 10000 &&
-             hal->joystick.y >= 6000 && hal->joystick.y <= 10000)
-    {
-         // Reset joystick flag when joystick is centered.
-         app->joystickCentered = true;
-    }
+    uint32_t* swap_p;
+    JoystickDirection pushed = Joystick_tapped4(&hal->joystick);
+    if (pushed == JOYSTICK_UP)
+         swap_p = &app->colorWheel.up;
+    else if (pushed == JOYSTICK_DOWN)
+         swap_p = &app->colorWheel.down;
+    else if (pushed == JOYSTICK_LEFT)
+         swap_p = &app->colorWheel.left;
+    else if (pushed == JOYSTICK_RIGHT)
+         swap_p = &app->colorWheel.right;
+    else
+         return; // Nothing pushed.
+    // Swap the center color with the one pushed toward.
+    uint32_t temp = app->colorWheel.center;
+    app->colorWheel.center = *swap_p;
+    *swap_p = temp;
+    drawColorWheel(app);
 }
 
 // Updates the game score based on difficulty and elapsed time.
@@ -575,18 +602,9 @@ void updateScore(Application* app, HAL* hal)
 {
     if (SWTimer_expired(&app->scoreTimer))
     {
-         if (app->difficulty == 1)
-              app->score += 3;
-         else if (app->difficulty == 2)
-              app->score += 1;
-         else
-              app->score += 1;
-         char scoreStr[20];
-         sprintf(scoreStr, "Score : %d", app->score);
-
-         GFX_setForeground(&hal->gfx, 0xFFFFFF);
-
-         GFX_print(&hal->gfx, scoreStr, 0, 0);
+         app->score += difficultyModes[app->difficulty].pointsPerSecond;
+         // Only the number changes; the "Score : " label stays on screen.
+         Sprites_update(&app->sprites, &app->scoreSprite, scoreRect(app));
          SWTimer_start(&app->scoreTimer); // Restart the score timer.
     }
 }
@@ -594,26 +612,25 @@ void updateScore(Application* app, HAL* hal)
 // Ends the game and updates the high score table.
 void endGame(Application* app, HAL* hal)
 {
-    int newScore = app->score;
-    int i;
-    int j;
-    // Insert new score into high score list if it is high enough.
-    for (i = 0; i < app->maxHighScores; i++)
+    // A score that makes the table is appended to the flash log.
+    if (ScoreLog_add(&scoreLog, app->score))
     {
-         if (newScore > app->highScores[i])
-         {
-              for (j = app->maxHighScores - 1; j > i; j--)
-              {
-                   app->highScores[j] = app->highScores[j - 1];
-              }
-              app->highScores[i] = newScore;
-              break;
-         }
+         loadHighScores(app);
     }
     app->state = STATE_GAMEOVER;
     app->screenNeedsRedraw = true;
 }
 
+// Copies the saved table into the high score list; empty slots show 0.
+void loadHighScores(Application* app)
+{
+    int i;
+    for (i = 0; i < app->maxHighScores; i++)
+    {
+         app->highScores[i] = i < scoreLog.count ? scoreLog.best[i] : 0;
+    }
+}
+
 // Handles the game over screen and input for restarting or returning to the menu.
 void App_Screen_handleGameOver(Application* app, HAL* hal)
 {
@@ -621,9 +638,8 @@ void App_Screen_handleGameOver(Application* app, HAL* hal)
     {
          GFX_clear(&hal->gfx);
          GFX_setForeground(&hal->gfx, 0xFFFFFF);
-         char gameOverMsg[30];
-         sprintf(gameOverMsg, "Game Over! Score: %d", app->score);
-         GFX_print(&hal->gfx, gameOverMsg, 4, 0);
+         GFX_print(&hal->gfx, "Game Over! Score: ", 4, 0);
+         GFX_printInt(&hal->gfx, app->score, 0, 4, 18);
          GFX_print(&hal->gfx, "Press BB1 to Retry", 6, 0);
          GFX_print(&hal->gfx, "Press BB2 for Menu", 7, 0);
          app->screenNeedsRedraw = false;
@@ -642,94 +658,124 @@ void App_Screen_handleGameOver(Application* app, HAL* hal)
     }
 }
 
-// Returns a random color from the color wheel.
-uint32_t getRandomColor(ColorWheel* wheel)
+// Returns a random color from the first colorCount wheel colors.
+uint32_t getRandomColor(Random* random_p, int colorCount)
 {
-    int r = rand() % 5;
-    switch (r)
-    {
-         case 0: return wheel->center;
-         case 1: return wheel->up;
-         case 2: return wheel->down;
-         case 3: return wheel->left;
-         case 4: return wheel->right;
-         default: return wheel->center;
-    }
+    return wheelColors[Random_below(random_p, colorCount)];
 }
 
 // Initializes the floor segments for the game.
 void initFloor(Application* app)
 {
-    int segCount = 0;
-    int x = 0;
-    // Create floor segments until the screen width is covered.
-    while (x < 128)
-    {
-         app->floorSegments[segCount].x = x;
-         app->floorSegments[segCount].width = 125;
-         if (segCount == 0)
-              app->floorSegments[segCount].color = app->colorWheel.center;
+    Floor_init(&app->floor);
+    app->floorParams = Difficulty_at(&difficultyModes[app->difficulty], app->score);
+    app->scrollFraction = 0;
+    // The player starts on a segment of their own color.
+    Floor_push(&app->floor, FLOOR_SEGMENT_MAX, app->colorWheel.center);
+    generateFloor(app);
+}
+
+// Emits segments and gaps ahead of the screen until the lookahead is covered.
+void generateFloor(Application* app)
+{
+    while (Floor_needsSegment(&app->floor))
+    {
+         const FloorSegment* last = Floor_segment(&app->floor, app->floor.count - 1);
+         bool pushed;
+         // The difficulty sets how often a segment is followed by a short gap,
+         // never two in a row.
+         if (last->color != FLOOR_GAP_COLOR &&
+             (int)Random_below(&app->floorRandom, 100) < app->floorParams.gapPercent)
+         {
+              int width = Random_range(&app->floorRandom, FLOOR_GAP_MIN, FLOOR_GAP_MAX);
+              pushed = Floor_push(&app->floor, width, FLOOR_GAP_COLOR);
+         }
          else
-              app->floorSegments[segCount].color = getRandomColor(&app->colorWheel);
-         x += 125;
-         segCount++;
+         {
+              int width = Random_range(&app->floorRandom, app->floorParams.segmentMin,
+                                       app->floorParams.segmentMax);
+              pushed = Floor_push(&app->floor, width,
+                                  getRandomColor(&app->colorRandom, app->floorParams.colorCount));
+         }
+         if (!pushed)
+              break;
     }
-    app->numFloorSegments = segCount;
 }
 
-// Update the floor by scrolling segments to create movement and adding new segments.
+// Update the floor by scrolling it to create movement and adding new segments.
 void updateFloor(Application* app)
 {
-    int scrollSpeed = (app->difficulty == 1 ? 2 : (app->difficulty == 2 ? 1 + (app->score / 25) : 1));
-    if (scrollSpeed > 4) scrollSpeed = 4;
-    int i;
-    // Scroll each floor segment to the left.
-    for (i = 0; i < app->numFloorSegments; i++)
-         app->floorSegments[i].x -= scrollSpeed;
-    // Remove floor segments that have scrolled off screen.
-    while (app->numFloorSegments > 0 &&
-           (app->floorSegments[0].x + app->floorSegments[0].width) <= 0)
-    {
-         for (i = 1; i < app->numFloorSegments; i++)
-              app->floorSegments[i - 1] = app->floorSegments[i];
-         app->numFloorSegments--;
-    }
-    int rightEdge = 0;
-    if (app->numFloorSegments > 0)
-         rightEdge = app->floorSegments[app->numFloorSegments - 1].x +
-                     app->floorSegments[app->numFloorSegments - 1].width;
-    // Add a new floor segment if there's space on the right.
-    if (rightEdge < 128)
-    {
-         FloorSegment newSeg;
-         newSeg.x = rightEdge;
-         newSeg.width = 125;
-         newSeg.color = getRandomColor(&app->colorWheel);
-         app->floorSegments[app->numFloorSegments] = newSeg;
-         app->numFloorSegments++;
-    }
+    // The difficulty curve at this score; a fractional speed carries its
+    // remainder over to the next tick.
+    app->floorParams = Difficulty_at(&difficultyModes[app->difficulty], app->score);
+    app->scrollFraction += app->floorParams.scrollSpeed;
+    int pixels = app->scrollFraction >> 16;
+    app->scrollFraction &= FIX16_ONE - 1;
+    // Scrolling moves the screen along the floor; segments never move.
+    Floor_scroll(&app->floor, pixels);
+    generateFloor(app);
+}
+
+// Marks floor band columns x1 to x2 for the sprite layer to repaint.
+static void markFloorColumns(Application* app, int x1, int x2)
+{
+    Sprites_invalidate(&app->sprites, SpriteRect_make(x1, FLOOR_SCREEN_Y, x2,
+                                                      FLOOR_SCREEN_Y + FLOOR_SCREEN_HEIGHT - 1));
 }
 
-// Draws the floor by iterating through each floor segment.
-void drawFloor(Application* app, GFX* gfx)
+// Marks for repainting only the floor columns whose color changed since the
+// last call: the strip scrolled in on the right and the columns a segment
+// edge moved across. Each run of changed columns is one rectangle, which the
+// sprite layer writes with the player layered over it.
+void drawFloor(Application* app)
 {
-    const int floorY = 105;
-    const int floorHeight = 18;
+    // Nothing scrolled and nothing drew over the band: the screen is current.
+    if (app->floor.scroll == app->floorShownScroll && !app->floorDirty)
+         return;
+
+    int runStart = 0;
+    int runEnd = 0; // An empty run.
     int i;
-    // Draw each segment of the floor.
-    for (i = 0; i < app->numFloorSegments; i++)
-    {
-         FloorSegment seg = app->floorSegments[i];
-         int startX = (seg.x < 0 ? 0 : seg.x);
-         int endX = seg.x + seg.width;
-         if (endX > 128) endX = 128;
-         if (startX < endX)
+    for (i = 0; i < app->floor.count; i++)
+    {
+         const FloorSegment* seg = Floor_segment(&app->floor, i);
+         int segX = Floor_screenX(&app->floor, seg);
+         if (segX >= FLOOR_VIEW_WIDTH) break; // The lookahead past the screen isn't drawn.
+         int startX = (segX < 0 ? 0 : segX);
+         int endX = segX + seg->width;
+         if (endX > FLOOR_VIEW_WIDTH) endX = FLOOR_VIEW_WIDTH;
+         uint8_t shown = floorShownIndex(seg->color);
+         int x;
+         for (x = startX; x < endX; x++)
          {
-              GFX_setForeground(gfx, seg.color);
-              int x;
-              // Draw vertical lines to form a filled rectangle segment.
-              for (x = startX; x < endX; x++)
-                   GFX_drawLine(gfx, x, floorY, x, floorY + floorHeight - 1);
+              if (app->floorShown[x] == shown)
+                   continue;
+              // Grow the run if this column continues it, else mark it and start anew.
+              if (x != runEnd)
+              {
+                   if (runStart < runEnd)
+                        markFloorColumns(app, runStart, runEnd - 1);
+                   runStart = x;
+              }
+              runEnd = x + 1;
+              app->floorShown[x] = shown;
          }
     }
+    if (runStart < runEnd)
+         markFloorColumns(app, runStart, runEnd - 1);
+
+    app->floorShownScroll = app->floor.scroll;
+    app->floorDirty = false;
+}
+
+// Marks screen columns x1 to x2 of the floor band for repainting, after the
+// screen was cleared.
+void invalidateFloor(Application* app, int x1, int x2)
+{
+    if (x1 < 0) x1 = 0;
+    if (x2 >= FLOOR_VIEW_WIDTH) x2 = FLOOR_VIEW_WIDTH - 1;
+    int x;
+    for (x = x1; x <= x2; x++)
+         app->floorShown[x] = FLOOR_UNDRAWN;
+    app->floorDirty = true;
 }
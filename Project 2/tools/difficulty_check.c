@@ -0,0 +1,227 @@
+// difficulty_check.c - Checks every difficulty curve against the frame budget
+//
+// Host tool, not part of the firmware. Build and run from the project folder:
+//
+//   cc -O2 -I. -o difficulty_check tools/difficulty_check.c Difficulty.c Floor.c Physics.c
+//   ./difficulty_check [seconds] [seed]
+//
+// For every mode in difficultyModes and every score up to 50 past the
+// curve's last point, the values from Difficulty_at must stay inside the
+// limits in Floor.h, a tap jump at that speed must clear the widest gap,
+// and the floor's worst case must fit DIFFICULTY_FLOOR_BUDGET_BYTES. The
+// worst case is a screen of the narrowest segments, each followed by the
+// narrowest gap, with every edge moving a whole pass's scroll.
+//
+// Each mode is then played for the given number of seconds (300 by
+// default) with no falls: the floor is generated as generateFloor does, the
+// score rises at the mode's rate, and each floor tick's repaint is counted
+// the way drawFloor marks it. The peak and mean are printed next to the
+// worst case. Exits with 1 if any check fails.
+
+#include <Difficulty.h>
+#include <Floor.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Column and row address commands with four bytes each, then the memory
+// write command, as Parallax.h counts a window
+#define WINDOW_BYTES 11
+#define COLUMN_BYTES (FLOOR_SCREEN_HEIGHT * 2)
+#define TICKS_PER_SECOND (1000 / PHYSICS_STEP_MS)
+
+static uint32_t randomState = 1;
+
+static uint32_t nextRandom(void) {
+  uint32_t x = randomState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return randomState = x;
+}
+
+static int randomBelow(int bound) {
+  return (int)(nextRandom() % (uint32_t)bound);
+}
+
+static int failures;
+
+static void fail(const DifficultyMode* mode_p, int score, const char* what) {
+  printf("  %s at score %d: %s\n", mode_p->name, score, what);
+  failures++;
+}
+
+// Floor ticks a tap jump stays in the air
+static int tapAirSteps(void) {
+  Physics physics;
+  int steps = 0;
+
+  Physics_init(&physics, 100);
+  Physics_jump(&physics);
+  while (!physics.onGround) {
+    Physics_step(&physics, false, true);
+    steps++;
+  }
+  return steps;
+}
+
+// Most bytes one pass can mark: every visible edge between two pieces moves
+// by the pass's scroll, each edge in a window of its own
+static int worstFloorBytes(const DifficultyPoint* at_p) {
+  int pixels = (at_p->scrollSpeed + FIX16_ONE - 1) >> 16;
+  int span = FLOOR_VIEW_WIDTH + pixels;
+  int period = at_p->segmentMin + (at_p->gapPercent > 0 ? FLOOR_GAP_MIN : 0);
+  int edgesPerPeriod = at_p->gapPercent > 0 ? 2 : 1;
+  int edges = edgesPerPeriod * ((span + period - 1) / period) + 1;
+
+  return edges * (pixels * COLUMN_BYTES + WINDOW_BYTES);
+}
+
+static void checkPoint(const DifficultyMode* mode_p, const DifficultyPoint* at_p, int airSteps) {
+  int score = at_p->score;
+
+  if (at_p->scrollSpeed <= 0 || at_p->scrollSpeed > FIX16_FROM_INT(8)) {
+    fail(mode_p, score, "scroll speed outside 0..8 pixels a tick");
+  }
+  if (at_p->segmentMin < FLOOR_SEGMENT_MIN || at_p->segmentMax > FLOOR_SEGMENT_MAX ||
+      at_p->segmentMin > at_p->segmentMax) {
+    fail(mode_p, score, "segment widths outside FLOOR_SEGMENT_MIN..FLOOR_SEGMENT_MAX");
+  }
+  if (at_p->colorCount < 1 || at_p->colorCount > DIFFICULTY_MAX_COLORS) {
+    fail(mode_p, score, "color count outside 1..DIFFICULTY_MAX_COLORS");
+  }
+  if (at_p->gapPercent < 0 || at_p->gapPercent > 100) {
+    fail(mode_p, score, "gap chance outside 0..100");
+  }
+  if (at_p->gapPercent > 0 &&
+      ((int64_t)airSteps * at_p->scrollSpeed >> 16) <= FLOOR_GAP_MAX) {
+    fail(mode_p, score, "a tap jump doesn't clear the widest gap");
+  }
+  if (worstFloorBytes(at_p) > DIFFICULTY_FLOOR_BUDGET_BYTES) {
+    fail(mode_p, score, "worst case floor repaint is over budget");
+  }
+}
+
+// Push pieces until the lookahead is covered, like generateFloor
+static void generate(Floor* floor_p, const DifficultyPoint* at_p) {
+  while (Floor_needsSegment(floor_p)) {
+    const FloorSegment* last = Floor_segment(floor_p, floor_p->count - 1);
+    bool pushed;
+    if (last->color != FLOOR_GAP_COLOR && randomBelow(100) < at_p->gapPercent) {
+      pushed = Floor_push(floor_p, FLOOR_GAP_MIN + randomBelow(FLOOR_GAP_MAX - FLOOR_GAP_MIN + 1),
+                          FLOOR_GAP_COLOR);
+    } else {
+      int width = at_p->segmentMin + randomBelow(at_p->segmentMax - at_p->segmentMin + 1);
+      pushed = Floor_push(floor_p, width, 1 + randomBelow(at_p->colorCount));
+    }
+    if (!pushed) {
+      break;
+    }
+  }
+}
+
+// Bytes drawFloor marks to bring shown up to date with the floor
+static int repaintBytes(const Floor* floor_p, uint32_t* shown) {
+  int bytes = 0;
+  int runEnd = -1;
+  int x;
+
+  for (x = 0; x < FLOOR_VIEW_WIDTH; x++) {
+    const FloorSegment* segment_p = Floor_segmentAt(floor_p, x);
+    uint32_t color = segment_p ? segment_p->color : FLOOR_GAP_COLOR;
+    if (shown[x] == color) {
+      continue;
+    }
+    bytes += COLUMN_BYTES + (x == runEnd ? 0 : WINDOW_BYTES);
+    runEnd = x + 1;
+    shown[x] = color;
+  }
+  return bytes;
+}
+
+// Play seconds of the mode and report its repaint costs
+static void play(const DifficultyMode* mode_p, int seconds) {
+  Floor floor;
+  uint32_t shown[FLOOR_VIEW_WIDTH];
+  Fix16 fraction = 0;
+  int score = 0;
+  int peak = 0;
+  int worst = 0;
+  long total = 0;
+  long ticks = (long)seconds * TICKS_PER_SECOND;
+  long t;
+  int x;
+
+  DifficultyPoint at = Difficulty_at(mode_p, score);
+  Floor_init(&floor);
+  Floor_push(&floor, FLOOR_SEGMENT_MAX, 1);
+  generate(&floor, &at);
+  for (x = 0; x < FLOOR_VIEW_WIDTH; x++) {
+    shown[x] = 1;
+  }
+
+  for (t = 1; t <= ticks; t++) {
+    if (t % TICKS_PER_SECOND == 0) {
+      score += mode_p->pointsPerSecond;
+    }
+    at = Difficulty_at(mode_p, score);
+    fraction += at.scrollSpeed;
+    Floor_scroll(&floor, fraction >> 16);
+    fraction &= FIX16_ONE - 1;
+    generate(&floor, &at);
+
+    int bytes = repaintBytes(&floor, shown);
+    total += bytes;
+    if (bytes > peak) {
+      peak = bytes;
+    }
+    if (worstFloorBytes(&at) > worst) {
+      worst = worstFloorBytes(&at);
+    }
+  }
+
+  printf("%-10s score %5d  worst %5d B  peak %5d B  mean %7.1f B  budget %d B\n", mode_p->name,
+         score, worst, peak, (double)total / ticks, DIFFICULTY_FLOOR_BUDGET_BYTES);
+  if (peak > DIFFICULTY_FLOOR_BUDGET_BYTES) {
+    fail(mode_p, score, "a played tick was over budget");
+  }
+}
+
+int main(int argc, char** argv) {
+  int seconds = argc > 1 ? atoi(argv[1]) : 300;
+  int airSteps = tapAirSteps();
+  int m, i, score;
+
+  if (argc > 2) {
+    randomState = (uint32_t)strtoul(argv[2], NULL, 0);
+    if (randomState == 0) {
+      randomState = 1;
+    }
+  }
+
+  for (m = 0; m < difficultyModeCount; m++) {
+    const DifficultyMode* mode_p = &difficultyModes[m];
+    if (mode_p->pointCount < 1) {
+      fail(mode_p, 0, "no points");
+      continue;
+    }
+    for (i = 1; i < mode_p->pointCount; i++) {
+      if (mode_p->points[i].score <= mode_p->points[i - 1].score) {
+        fail(mode_p, mode_p->points[i].score, "points out of score order");
+      }
+    }
+    int lastScore = mode_p->points[mode_p->pointCount - 1].score + 50;
+    for (score = 0; score <= lastScore; score++) {
+      DifficultyPoint at = Difficulty_at(mode_p, score);
+      checkPoint(mode_p, &at, airSteps);
+    }
+    play(mode_p, seconds);
+  }
+
+  if (failures > 0) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("all curves within budget\n");
+  return 0;
+}
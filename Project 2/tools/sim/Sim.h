@@ -0,0 +1,36 @@
+// Sim.h - The simulated board under tools/sim
+//
+// Time is a count of 48 MHz cycles that only moves when the simulation
+// moves it: a read of Timer32, a byte sent to the LCD, or the cost sim.c
+// charges for each pass of the main loop. Moving it fires the interrupts
+// that fall due on the way, the Timer32 rollover and the joystick's DMA,
+// in order, so the HAL code runs unchanged.
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Polled SPI at 16 MHz sends about one byte a microsecond
+#define SIM_LCD_CYCLES_PER_BYTE 48
+
+// Power the board on with inputs at rest; seed drives the ADC noise
+void SimBoard_init(uint32_t seed);
+
+// Cycles since power on
+uint64_t SimBoard_cycles(void);
+
+// Let cycles pass, firing the interrupts due meanwhile
+void SimBoard_run(uint64_t cycles);
+
+// Hold or let go of the button on port and pin
+void SimBoard_setButton(uint8_t port, uint16_t pin, bool pressed);
+
+// Put the joystick at x, y in ADC counts
+void SimBoard_setStick(int x, int y);
+
+// LCD bytes sent since power on
+uint64_t SimGraphics_bytes(void);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,343 @@
+// SimBoard.c - Driverlib, interrupts and flash of a simulated LaunchPad
+//
+// Implements the driverlib calls the HAL makes, on top of a virtual cycle
+// count. Timer32 counts down from when it is started and raises its
+// rollover interrupt every 2^32 cycles, as on the board. Once Timer_A0,
+// the ADC sequence and DMA channel 7 are all running, every
+// JOYSTICK_SEQUENCE_LENGTH sample periods the ADC results for the
+// joystick's position, with a little noise, land in the ring half the DMA
+// channel points at and DMA_INT1_IRQHandler runs. Buttons read as pulled up
+// until held. The two score sectors are RAM that keeps the rules of flash:
+// programming can only clear bits.
+
+#include <HAL/Joystick.h>
+#include <HAL/ScoreFlash.h>
+#include <HAL/Timer.h>
+#include <Sim.h>
+#include <string.h>
+
+// The HAL's interrupt handlers
+void T32_INT1_IRQHandler();
+void DMA_INT1_IRQHandler(void);
+
+// Each Timer32 read takes this long, so a loop polling a timer sees it move
+#define TIMER_READ_CYCLES 16
+
+// One ADC sequence, which fills one ring half
+#define SEQUENCE_CYCLES \
+  ((uint64_t)JOYSTICK_SEQUENCE_LENGTH * JOYSTICK_SAMPLE_PERIOD_US * (SYSTEM_CLOCK / 1000000))
+
+// Joystick readings stray this many counts either way
+#define STICK_NOISE 24
+
+#define ADC_MAX 0x3FFF
+#define PORTS 9
+
+static uint64_t cycles;
+static bool inInterrupt;
+static bool interruptsOn;
+static uint32_t noiseState = 1;
+
+static uint8_t inputLevels[PORTS];
+static int stickX = JOYSTICK_CENTER;
+static int stickY = JOYSTICK_CENTER;
+
+static bool timer32Running;
+static bool timer32Interrupt;
+static uint64_t timer32Start;
+static uint64_t nextRollover;
+
+static bool timerARunning;
+static bool adcConverting;
+static bool dmaRunning;
+static bool dmaInterrupt;
+static bool onAlternate;           // the DMA channel is filling the alternate half
+static uint32_t* dmaDestination[2];  // primary, alternate
+static uint64_t nextSequence;
+
+static ADC14_Type adc;
+ADC14_Type* const ADC14 = &adc;
+
+static uint8_t flash[SCOREFLASH_SECTORS][SCOREFLASH_SECTOR_SIZE];
+
+static uint32_t nextNoise(void) {
+  uint32_t x = noiseState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return noiseState = x;
+}
+
+// A conversion of level, give or take the noise
+static uint32_t sample(int level) {
+  level += (int)(nextNoise() % (2 * STICK_NOISE + 1)) - STICK_NOISE;
+  if (level < 0) {
+    return 0;
+  }
+  return level > ADC_MAX ? ADC_MAX : (uint32_t)level;
+}
+
+void SimBoard_init(uint32_t seed) {
+  cycles = 0;
+  noiseState = seed != 0 ? seed : 1;
+  memset(inputLevels, 0xFF, sizeof(inputLevels));
+  memset(flash, 0xFF, sizeof(flash));
+}
+
+uint64_t SimBoard_cycles(void) {
+  return cycles;
+}
+
+// The ADC has finished a sequence: DMA copies it to the ring half armed for
+// it, switches to the other control structure and interrupts
+static void completeSequence(void) {
+  uint32_t* destination = dmaDestination[onAlternate];
+  int i;
+
+  for (i = 0; i < JOYSTICK_SEQUENCE_LENGTH; i += 2) {
+    adc.MEM[i] = sample(stickX);
+    adc.MEM[i + 1] = sample(stickY);
+  }
+  if (destination != NULL) {
+    memcpy(destination, (const void*)adc.MEM, JOYSTICK_SEQUENCE_LENGTH * sizeof(uint32_t));
+  }
+  onAlternate = !onAlternate;
+  if (interruptsOn && dmaInterrupt) {
+    inInterrupt = true;
+    DMA_INT1_IRQHandler();
+    inInterrupt = false;
+  }
+}
+
+// Move to the next event due by end, or to end; false once there
+static bool step(uint64_t end) {
+  bool sampling = timerARunning && adcConverting && dmaRunning;
+  uint64_t due = end;
+
+  if (timer32Running && nextRollover <= due) {
+    due = nextRollover;
+  }
+  if (sampling && nextSequence <= due) {
+    due = nextSequence;
+  }
+  cycles = due;
+
+  if (timer32Running && cycles == nextRollover) {
+    nextRollover += (uint64_t)1 << 32;
+    if (interruptsOn && timer32Interrupt) {
+      inInterrupt = true;
+      T32_INT1_IRQHandler();
+      inInterrupt = false;
+    }
+    return true;
+  }
+  if (sampling && cycles == nextSequence) {
+    nextSequence += SEQUENCE_CYCLES;
+    completeSequence();
+    return true;
+  }
+  return false;
+}
+
+void SimBoard_run(uint64_t count) {
+  uint64_t end = cycles + count;
+  while (step(end)) {
+  }
+}
+
+void SimBoard_setButton(uint8_t port, uint16_t pin, bool pressed) {
+  if (pressed) {
+    inputLevels[port] &= ~pin;
+  } else {
+    inputLevels[port] |= pin;
+  }
+}
+
+void SimBoard_setStick(int x, int y) {
+  stickX = x;
+  stickY = y;
+}
+
+// GPIO: outputs go nowhere, inputs are the simulated buttons
+
+void GPIO_setAsOutputPin(uint_fast8_t port, uint_fast16_t pins) {}
+void GPIO_setAsInputPinWithPullUpResistor(uint_fast8_t port, uint_fast16_t pins) {}
+void GPIO_setOutputLowOnPin(uint_fast8_t port, uint_fast16_t pins) {}
+void GPIO_setOutputHighOnPin(uint_fast8_t port, uint_fast16_t pins) {}
+void GPIO_toggleOutputOnPin(uint_fast8_t port, uint_fast16_t pins) {}
+void GPIO_setAsPeripheralModuleFunctionInputPin(uint_fast8_t port, uint_fast16_t pins,
+                                                uint_fast8_t mode) {}
+
+uint8_t GPIO_getInputPinValue(uint_fast8_t port, uint_fast16_t pins) {
+  return (inputLevels[port] & pins) ? GPIO_INPUT_PIN_HIGH : GPIO_INPUT_PIN_LOW;
+}
+
+// Clocks, flash wait states and the watchdog don't exist here
+
+bool FlashCtl_setWaitState(uint32_t bank, uint32_t waitState) {
+  return true;
+}
+void CS_setDCOFrequency(uint32_t dcoFrequency) {}
+void CS_initClockSignal(uint32_t selectedClockSignal, uint32_t clockSource,
+                        uint32_t clockSourceDivider) {}
+void WDT_A_holdTimer(void) {}
+
+void Interrupt_enableMaster(void) {
+  interruptsOn = true;
+}
+
+void Interrupt_disableMaster(void) {
+  interruptsOn = false;
+}
+
+void Interrupt_enableInterrupt(uint32_t interruptNumber) {
+  if (interruptNumber == INT_T32_INT1) {
+    timer32Interrupt = true;
+  } else if (interruptNumber == INT_DMA_INT1) {
+    dmaInterrupt = true;
+  }
+}
+
+// Timer32
+
+void Timer32_initModule(uint32_t timer, uint32_t preScaler, uint32_t resolution, uint32_t mode) {}
+void Timer32_setCount(uint32_t timer, uint32_t count) {}
+void Timer32_clearInterruptFlag(uint32_t timer) {}
+
+void Timer32_startTimer(uint32_t timer, bool oneShot) {
+  timer32Running = true;
+  timer32Start = cycles;
+  nextRollover = cycles + ((uint64_t)1 << 32);
+}
+
+uint32_t Timer32_getValue(uint32_t timer) {
+  if (!inInterrupt) {
+    SimBoard_run(TIMER_READ_CYCLES);
+  }
+  return LOADVALUE - (uint32_t)(cycles - timer32Start);
+}
+
+// Timer_A0 only matters as the ADC's trigger
+
+void Timer_A_configureUpMode(uint32_t timer, const Timer_A_UpModeConfig* config) {}
+void Timer_A_initCompare(uint32_t timer, const Timer_A_CompareModeConfig* config) {}
+
+void Timer_A_startCounter(uint32_t timer, uint_fast16_t timerMode) {
+  timerARunning = true;
+  nextSequence = cycles + SEQUENCE_CYCLES;
+}
+
+// ADC14: single conversions read a floating pin, which is all noise
+
+bool ADC14_enableModule(void) {
+  return true;
+}
+bool ADC14_disableModule(void) {
+  return true;
+}
+bool ADC14_initModule(uint32_t clockSource, uint32_t clockPredivider, uint32_t clockDivider,
+                      uint32_t internalChannelMask) {
+  return true;
+}
+bool ADC14_configureSingleSampleMode(uint32_t memoryDestination, bool repeatMode) {
+  return true;
+}
+bool ADC14_configureMultiSequenceMode(uint32_t memoryStart, uint32_t memoryEnd,
+                                      bool repeatMode) {
+  return true;
+}
+bool ADC14_configureConversionMemory(uint32_t memorySelect, uint32_t refSelect,
+                                     uint32_t channelSelect, bool differntialMode) {
+  return true;
+}
+bool ADC14_setSampleHoldTrigger(uint32_t source, bool invertSignal) {
+  return true;
+}
+bool ADC14_enableSampleTimer(uint32_t multiSampleConvert) {
+  return true;
+}
+
+bool ADC14_enableConversion(void) {
+  adcConverting = true;
+  return true;
+}
+
+void ADC14_disableConversion(void) {
+  adcConverting = false;
+}
+
+bool ADC14_toggleConversionTrigger(void) {
+  adc.MEM[0] = nextNoise() & ADC_MAX;
+  return true;
+}
+
+bool ADC14_isBusy(void) {
+  return false;
+}
+
+uint_fast16_t ADC14_getResult(uint32_t memorySelect) {
+  return adc.MEM[0];
+}
+
+// uDMA channel 7, ping-ponging between two destinations
+
+void DMA_enableModule(void) {}
+void DMA_setControlBase(void* controlTable) {}
+void DMA_assignChannel(uint32_t mapping) {}
+void DMA_disableChannelAttribute(uint32_t channelNum, uint32_t attr) {}
+void DMA_setChannelControl(uint32_t channelStructIndex, uint32_t control) {}
+void DMA_assignInterrupt(uint32_t interruptNumber, uint32_t channel) {}
+void DMA_clearInterruptFlag(uint32_t intChannel) {}
+
+uint32_t DMA_getChannelAttribute(uint32_t channelNum) {
+  return onAlternate ? UDMA_ATTR_ALTSELECT : 0;
+}
+
+void DMA_setChannelTransfer(uint32_t channelStructIndex, uint32_t mode, void* srcAddr,
+                            void* dstAddr, uint32_t transferSize) {
+  dmaDestination[(channelStructIndex & UDMA_ALT_SELECT) ? 1 : 0] = dstAddr;
+}
+
+void DMA_enableChannel(uint32_t channelNum) {
+  dmaRunning = true;
+}
+
+// UART: always ready to send, never anything received
+
+bool UART_initModule(uint32_t moduleInstance, const eUSCI_UART_ConfigV1* config) {
+  return true;
+}
+void UART_enableModule(uint32_t moduleInstance) {}
+void UART_transmitData(uint32_t moduleInstance, uint_fast8_t transmitData) {}
+
+uint_fast8_t UART_getInterruptStatus(uint32_t moduleInstance, uint8_t mask) {
+  return mask & EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG;
+}
+
+uint8_t UART_receiveData(uint32_t moduleInstance) {
+  return 0;
+}
+
+// Score sectors
+
+const uint8_t* ScoreFlash_sector(int index) {
+  return flash[index];
+}
+
+bool ScoreFlash_erase(int index) {
+  memset(flash[index], 0xFF, SCOREFLASH_SECTOR_SIZE);
+  return true;
+}
+
+bool ScoreFlash_program(int index, int offset, const void* data, int length) {
+  const uint8_t* bytes = data;
+  int i;
+
+  if (offset < 0 || offset + length > SCOREFLASH_SECTOR_SIZE) {
+    return false;
+  }
+  for (i = 0; i < length; i++) {
+    flash[index][offset + i] &= bytes[i];
+  }
+  return true;
+}
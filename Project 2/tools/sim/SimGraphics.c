@@ -0,0 +1,170 @@
+// SimGraphics.c - HAL/Graphics.c for the host simulator, counting LCD bytes
+//
+// Nothing is drawn. Each call counts the bytes the ST7735 driver would
+// send over SPI for it and lets the clock run for them, so drawing takes
+// the time it takes on the board. A window is the column and row address
+// commands with four bytes each plus the memory write command, and a
+// pixel is two bytes. grlib sends opaque text one glyph row at a time, a
+// window of its own each, and lines and circle outlines a pixel at a time.
+
+#include <HAL/Format.h>
+#include <HAL/Graphics.h>
+#include <Sim.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WINDOW_BYTES 11
+#define PIXEL_BYTES 2
+#define SCREEN_SIZE 128
+
+static const Graphics_Font fixed6x8 = {6, 8};
+
+static uint64_t lcdBytes;
+
+uint64_t SimGraphics_bytes(void) {
+  return lcdBytes;
+}
+
+static void send(long bytes) {
+  lcdBytes += bytes;
+  SimBoard_run((uint64_t)bytes * SIM_LCD_CYCLES_PER_BYTE);
+}
+
+// A filled window of pixels
+static void sendArea(int width, int height) {
+  if (width > 0 && height > 0) {
+    send(WINDOW_BYTES + (long)width * height * PIXEL_BYTES);
+  }
+}
+
+// Pixels drawn one by one
+static void sendPixels(int count) {
+  send((long)count * (WINDOW_BYTES + PIXEL_BYTES));
+}
+
+GFX GFX_construct(uint32_t defaultForeground, uint32_t defaultBackground) {
+  GFX gfx;
+
+  gfx.defaultForeground = defaultForeground;
+  gfx.defaultBackground = defaultBackground;
+  gfx.context.font = &fixed6x8;
+
+  GFX_resetColors(&gfx);
+  GFX_clear(&gfx);
+
+  return gfx;
+}
+
+void GFX_resetColors(GFX* gfx_p) {
+  gfx_p->foreground = gfx_p->defaultForeground;
+  gfx_p->background = gfx_p->defaultBackground;
+  gfx_p->context.foreground = gfx_p->foreground;
+  gfx_p->context.background = gfx_p->background;
+}
+
+void GFX_clear(GFX* gfx_p) {
+  sendArea(SCREEN_SIZE, SCREEN_SIZE);
+}
+
+void GFX_print(GFX* gfx_p, char* string, float row, float col) {
+  int length = strlen(string);
+  int i;
+
+  for (i = 0; i < length * fixed6x8.height; i++) {
+    sendArea(fixed6x8.maxWidth, 1);
+  }
+}
+
+void GFX_printInt(GFX* gfx_p, int32_t value, int width, float row, float col) {
+  char text[FORMAT_MAX_INT_LEN];
+  Format_int(text, value, width, ' ');
+  GFX_print(gfx_p, text, row, col);
+}
+
+void GFX_eraseText(GFX* gfx_p, char* string, float row, float col) {
+  GFX_print(gfx_p, string, row, col);
+}
+
+int GFX_printTextRows(GFX* gfx_p, char* strings[], int numStrings, float firstRow, float col) {
+  int i;
+  for (i = 0; i < numStrings; i++) {
+    GFX_print(gfx_p, strings[i], firstRow++, col);
+  }
+  return firstRow;
+}
+
+void GFX_setForeground(GFX* gfx_p, uint32_t foreground) {
+  gfx_p->foreground = foreground;
+  gfx_p->context.foreground = foreground;
+}
+
+void GFX_setBackground(GFX* gfx_p, uint32_t background) {
+  gfx_p->background = background;
+  gfx_p->context.background = background;
+}
+
+// A filled circle goes out as one horizontal line per row
+void GFX_drawSolidCircle(GFX* gfx_p, int x, int y, int radius) {
+  int dy;
+  for (dy = -radius; dy <= radius; dy++) {
+    int half = 0;
+    while ((half + 1) * (half + 1) + dy * dy <= radius * radius) {
+      half++;
+    }
+    sendArea(2 * half + 1, 1);
+  }
+}
+
+// About 2 * pi * r outline pixels
+void GFX_drawHollowCircle(GFX* gfx_p, int x, int y, int radius) {
+  sendPixels(44 * radius / 7);
+}
+
+void GFX_removeSolidCircle(GFX* gfx_p, int x, int y, int radius) {
+  GFX_drawSolidCircle(gfx_p, x, y, radius);
+}
+
+void GFX_removeHollowCircle(GFX* gfx_p, int x, int y, int radius) {
+  GFX_drawHollowCircle(gfx_p, x, y, radius);
+}
+
+void GFX_drawSolidRectangle(GFX* gfx_p, int x1, int x2, int y1, int y2) {
+  sendArea(x2 - x1 + 1, y2 - y1 + 1);
+}
+
+// Four edges, each a line of its own
+void GFX_drawHollowRectangle(GFX* gfx_p, int x1, int x2, int y1, int y2) {
+  sendArea(x2 - x1 + 1, 1);
+  sendArea(x2 - x1 + 1, 1);
+  sendArea(1, y2 - y1 + 1);
+  sendArea(1, y2 - y1 + 1);
+}
+
+void GFX_removeSolidRectangle(GFX* gfx_p, int x1, int x2, int y1, int y2) {
+  GFX_drawSolidRectangle(gfx_p, x1, x2, y1, y2);
+}
+
+// Straight lines are one window; any other goes pixel by pixel
+void GFX_drawLine(GFX* gfx_p, int x1, int y1, int x2, int y2) {
+  int dx = abs(x2 - x1);
+  int dy = abs(y2 - y1);
+
+  if (dx == 0 || dy == 0) {
+    sendArea(dx + 1, dy + 1);
+  } else {
+    sendPixels((dx > dy ? dx : dy) + 1);
+  }
+}
+
+// 24-bit RGB to the LCD's 16-bit 5-6-5 pixel, high byte sent first
+uint16_t GFX_toPixel(uint32_t color) {
+  return ((color & 0xF80000) >> 8) | ((color & 0x00FC00) >> 5) | ((color & 0x0000F8) >> 3);
+}
+
+void GFX_startWindow(GFX* gfx_p, int x1, int y1, int x2, int y2) {
+  send(WINDOW_BYTES);
+}
+
+void GFX_writePixels(GFX* gfx_p, const uint16_t* pixels, int count) {
+  send((long)count * PIXEL_BYTES);
+}
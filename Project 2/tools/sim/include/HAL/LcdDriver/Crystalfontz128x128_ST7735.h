@@ -0,0 +1,3 @@
+// Crystalfontz128x128_ST7735.h - HAL/Graphics.h's path to the stand-in
+
+#include <LcdDriver/Crystalfontz128x128_ST7735.h>
@@ -0,0 +1,12 @@
+// Crystalfontz128x128_ST7735.h - Empty stand-in for the host simulator
+//
+// HAL/HAL.h and HAL/Graphics.h include the LCD driver's header, but nothing
+// in it is used outside HAL/Graphics.c, which the simulator replaces.
+
+#ifndef SIM_CRYSTALFONTZ128X128_ST7735_H_
+#define SIM_CRYSTALFONTZ128X128_ST7735_H_
+
+#define LCD_VERTICAL_MAX 128
+#define LCD_HORIZONTAL_MAX 128
+
+#endif /* SIM_CRYSTALFONTZ128X128_ST7735_H_ */
@@ -0,0 +1,225 @@
+// driverlib.h - The part of driverlib Color Jump uses, for the host simulator
+//
+// Stands in for the SimpleLink SDK's header when tools/sim builds the game
+// on a PC. Only the names the sources use are here. Constants that matter
+// to the simulation (ports, pins, DMA selects and attributes) keep their
+// meaning; the rest are placeholders. SimBoard.c implements the functions.
+
+#ifndef SIM_DRIVERLIB_H_
+#define SIM_DRIVERLIB_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// GPIO
+
+#define GPIO_PORT_P1 1
+#define GPIO_PORT_P2 2
+#define GPIO_PORT_P3 3
+#define GPIO_PORT_P4 4
+#define GPIO_PORT_P5 5
+#define GPIO_PORT_P6 6
+#define GPIO_PORT_P7 7
+#define GPIO_PORT_P8 8
+
+#define GPIO_PIN0 0x01
+#define GPIO_PIN1 0x02
+#define GPIO_PIN2 0x04
+#define GPIO_PIN3 0x08
+#define GPIO_PIN4 0x10
+#define GPIO_PIN5 0x20
+#define GPIO_PIN6 0x40
+#define GPIO_PIN7 0x80
+
+#define GPIO_PRIMARY_MODULE_FUNCTION 1
+#define GPIO_TERTIARY_MODULE_FUNCTION 3
+#define GPIO_INPUT_PIN_LOW 0
+#define GPIO_INPUT_PIN_HIGH 1
+
+void GPIO_setAsOutputPin(uint_fast8_t port, uint_fast16_t pins);
+void GPIO_setAsInputPinWithPullUpResistor(uint_fast8_t port, uint_fast16_t pins);
+void GPIO_setOutputLowOnPin(uint_fast8_t port, uint_fast16_t pins);
+void GPIO_setOutputHighOnPin(uint_fast8_t port, uint_fast16_t pins);
+void GPIO_toggleOutputOnPin(uint_fast8_t port, uint_fast16_t pins);
+uint8_t GPIO_getInputPinValue(uint_fast8_t port, uint_fast16_t pins);
+void GPIO_setAsPeripheralModuleFunctionInputPin(uint_fast8_t port, uint_fast16_t pins,
+                                                uint_fast8_t mode);
+
+// Clocks, flash, watchdog and interrupts
+
+#define FLASH_BANK0 0
+#define FLASH_BANK1 1
+
+#define CS_MCLK 1
+#define CS_HSMCLK 2
+#define CS_SMCLK 4
+#define CS_ACLK 8
+#define CS_REFOCLK_SELECT 2
+#define CS_DCOCLK_SELECT 3
+#define CS_CLOCK_DIVIDER_1 0
+
+#define INT_T32_INT1 41
+#define INT_DMA_INT1 47
+
+bool FlashCtl_setWaitState(uint32_t bank, uint32_t waitState);
+void CS_setDCOFrequency(uint32_t dcoFrequency);
+void CS_initClockSignal(uint32_t selectedClockSignal, uint32_t clockSource,
+                        uint32_t clockSourceDivider);
+void WDT_A_holdTimer(void);
+void Interrupt_enableMaster(void);
+void Interrupt_disableMaster(void);
+void Interrupt_enableInterrupt(uint32_t interruptNumber);
+
+// Timer32, the system clock's free-running down counter
+
+#define TIMER32_0_BASE 0x4000C000
+#define TIMER32_PRESCALER_1 0
+#define TIMER32_32BIT 1
+#define TIMER32_PERIODIC_MODE 1
+
+void Timer32_initModule(uint32_t timer, uint32_t preScaler, uint32_t resolution, uint32_t mode);
+void Timer32_setCount(uint32_t timer, uint32_t count);
+void Timer32_startTimer(uint32_t timer, bool oneShot);
+uint32_t Timer32_getValue(uint32_t timer);
+void Timer32_clearInterruptFlag(uint32_t timer);
+
+// Timer_A, which paces the joystick's conversions
+
+#define TIMER_A0_BASE 0x40000000
+#define TIMER_A_CLOCKSOURCE_SMCLK 0x0200
+#define TIMER_A_CLOCKSOURCE_DIVIDER_48 48
+#define TIMER_A_TAIE_INTERRUPT_DISABLE 0x00
+#define TIMER_A_CCIE_CCR0_INTERRUPT_DISABLE 0x00
+#define TIMER_A_DO_CLEAR 0x0004
+#define TIMER_A_UP_MODE 0x0010
+#define TIMER_A_CAPTURECOMPARE_REGISTER_1 0x04
+#define TIMER_A_CAPTURECOMPARE_INTERRUPT_DISABLE 0x00
+#define TIMER_A_OUTPUTMODE_SET_RESET 0x60
+
+typedef struct {
+  uint_fast16_t clockSource;
+  uint_fast16_t clockSourceDivider;
+  uint_fast16_t timerPeriod;
+  uint_fast16_t timerInterruptEnable_TAIE;
+  uint_fast16_t captureCompareInterruptEnable_CCR0_CCIE;
+  uint_fast16_t timerClear;
+} Timer_A_UpModeConfig;
+
+typedef struct {
+  uint_fast16_t compareRegister;
+  uint_fast16_t compareInterruptEnable;
+  uint_fast16_t compareOutputMode;
+  uint_fast16_t compareValue;
+} Timer_A_CompareModeConfig;
+
+void Timer_A_configureUpMode(uint32_t timer, const Timer_A_UpModeConfig* config);
+void Timer_A_initCompare(uint32_t timer, const Timer_A_CompareModeConfig* config);
+void Timer_A_startCounter(uint32_t timer, uint_fast16_t timerMode);
+
+// ADC14
+
+#define ADC_MEM0 0x00000001
+#define ADC_MEM15 0x00008000
+#define ADC_CLOCKSOURCE_SYSOSC 0
+#define ADC_PREDIVIDER_1 0
+#define ADC_DIVIDER_1 0
+#define ADC_VREFPOS_AVCC_VREFNEG_VSS 0
+#define ADC_NONDIFFERENTIAL_INPUTS false
+#define ADC_INPUT_A9 9
+#define ADC_INPUT_A15 15
+#define ADC_INPUT_A22 22
+#define ADC_MANUAL_ITERATION 0
+#define ADC_TRIGGER_SOURCE1 1
+
+typedef struct {
+  volatile uint32_t MEM[32];
+} ADC14_Type;
+
+extern ADC14_Type* const ADC14;
+
+bool ADC14_enableModule(void);
+bool ADC14_disableModule(void);
+bool ADC14_initModule(uint32_t clockSource, uint32_t clockPredivider, uint32_t clockDivider,
+                      uint32_t internalChannelMask);
+bool ADC14_configureSingleSampleMode(uint32_t memoryDestination, bool repeatMode);
+bool ADC14_configureMultiSequenceMode(uint32_t memoryStart, uint32_t memoryEnd,
+                                      bool repeatMode);
+bool ADC14_configureConversionMemory(uint32_t memorySelect, uint32_t refSelect,
+                                     uint32_t channelSelect, bool differntialMode);
+bool ADC14_setSampleHoldTrigger(uint32_t source, bool invertSignal);
+bool ADC14_enableSampleTimer(uint32_t multiSampleConvert);
+bool ADC14_enableConversion(void);
+void ADC14_disableConversion(void);
+bool ADC14_toggleConversionTrigger(void);
+bool ADC14_isBusy(void);
+uint_fast16_t ADC14_getResult(uint32_t memorySelect);
+
+// uDMA
+
+typedef struct {
+  volatile void* srcEndAddr;
+  volatile void* dstEndAddr;
+  volatile uint32_t control;
+  volatile uint32_t spare;
+} DMA_ControlTable;
+
+#define DMA_CH7_ADC14 0x07000007
+#define DMA_INT1 1
+#define UDMA_PRI_SELECT 0x00000000
+#define UDMA_ALT_SELECT 0x00000008
+#define UDMA_SIZE_32 0x22000000
+#define UDMA_SRC_INC_32 0x08000000
+#define UDMA_DST_INC_32 0x80000000
+#define UDMA_ARB_16 0x00010000
+#define UDMA_MODE_PINGPONG 0x00000003
+#define UDMA_ATTR_USEBURST 0x00000001
+#define UDMA_ATTR_ALTSELECT 0x00000002
+#define UDMA_ATTR_HIGH_PRIORITY 0x00000004
+#define UDMA_ATTR_REQMASK 0x00000008
+
+void DMA_enableModule(void);
+void DMA_setControlBase(void* controlTable);
+void DMA_assignChannel(uint32_t mapping);
+void DMA_disableChannelAttribute(uint32_t channelNum, uint32_t attr);
+uint32_t DMA_getChannelAttribute(uint32_t channelNum);
+void DMA_setChannelControl(uint32_t channelStructIndex, uint32_t control);
+void DMA_setChannelTransfer(uint32_t channelStructIndex, uint32_t mode, void* srcAddr,
+                            void* dstAddr, uint32_t transferSize);
+void DMA_assignInterrupt(uint32_t interruptNumber, uint32_t channel);
+void DMA_clearInterruptFlag(uint32_t intChannel);
+void DMA_enableChannel(uint32_t channelNum);
+
+// eUSCI_A UART
+
+#define EUSCI_A0_BASE 0x40001000
+#define EUSCI_A_UART_NO_PARITY 0x00
+#define EUSCI_A_UART_8_BIT_LEN 0x00
+#define EUSCI_A_UART_ONE_STOP_BIT 0x00
+#define EUSCI_A_UART_LSB_FIRST 0x00
+#define EUSCI_A_UART_MODE 0x00
+#define EUSCI_A_UART_CLOCKSOURCE_SMCLK 0x80
+#define EUSCI_A_UART_OVERSAMPLING_BAUDRATE_GENERATION 0x01
+#define EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG 0x01
+#define EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG 0x02
+
+typedef struct {
+  uint_fast8_t selectClockSource;
+  uint_fast16_t clockPrescalar;
+  uint_fast8_t firstModReg;
+  uint_fast8_t secondModReg;
+  uint_fast8_t parity;
+  uint_fast16_t msborLsbFirst;
+  uint_fast16_t numberofStopBits;
+  uint_fast16_t uartMode;
+  uint_fast8_t overSampling;
+  uint_fast16_t dataLength;
+} eUSCI_UART_ConfigV1;
+
+bool UART_initModule(uint32_t moduleInstance, const eUSCI_UART_ConfigV1* config);
+void UART_enableModule(uint32_t moduleInstance);
+uint_fast8_t UART_getInterruptStatus(uint32_t moduleInstance, uint8_t mask);
+uint8_t UART_receiveData(uint32_t moduleInstance);
+void UART_transmitData(uint32_t moduleInstance, uint_fast8_t transmitData);
+
+#endif /* SIM_DRIVERLIB_H_ */
@@ -0,0 +1,25 @@
+// grlib.h - The part of grlib HAL/Graphics.h needs, for the host simulator
+//
+// Only the context type and colors. SimGraphics.c replaces HAL/Graphics.c,
+// so no grlib function is ever called.
+
+#ifndef SIM_GRLIB_H_
+#define SIM_GRLIB_H_
+
+#include <stdint.h>
+
+typedef struct {
+  uint8_t maxWidth;
+  uint8_t height;
+} Graphics_Font;
+
+typedef struct {
+  uint32_t foreground;
+  uint32_t background;
+  const Graphics_Font* font;
+} Graphics_Context;
+
+#define GRAPHICS_COLOR_BLACK 0x00000000
+#define GRAPHICS_COLOR_WHITE 0x00FFFFFF
+
+#endif /* SIM_GRLIB_H_ */
@@ -0,0 +1,771 @@
+// sim.c - Headless Color Jump: a bot or a script plays the real game code
+//
+// Host tool, not part of the firmware. Build and run from the project folder,
+// the build being one command:
+//
+//   cc -O2 -Itools/sim/include -Itools/sim -I. -Dmain=colorjump_main
+//      -finstrument-functions -finstrument-functions-exclude-file-list=tools/sim
+//      -o colorjump_sim tools/sim/*.c proj2_main.c Difficulty.c Floor.c Physics.c
+//      Sprites.c Parallax.c ScoreLog.c HAL/HAL.c HAL/Button.c HAL/Joystick.c
+//      HAL/LED.c HAL/Random.c HAL/Timer.c HAL/UART.c HAL/Format.c
+//   ./colorjump_sim [-c pass us] [-j workers] bot [games] [mode] [seed] [seconds]
+//   ./colorjump_sim [-c pass us] script <file or -> [seed]
+//
+// Leave out the two -finstrument-functions options for a build that runs
+// about four times faster but has no function table.
+//
+// proj2_main.c and the HAL are built as they are, against SimBoard.c in
+// place of driverlib and SimGraphics.c in place of HAL/Graphics.c. This
+// file boots the game the way main does and runs its loop on a virtual
+// clock: besides the LCD bytes and timer reads, which SimBoard.c and
+// SimGraphics.c charge as they happen, each pass of the loop costs the
+// CPU time given with -c, 150 us unless changed. That figure is an
+// estimate; measure a pass on a LaunchPad to tune it.
+//
+// bot plays 1000 games unless told otherwise, split between forked
+// workers, one per CPU by default. Each worker boots its own board, the
+// first with the given seed (1 by default) and each next one with the next
+// seed, picks the difficulty mode (by name or number, Easy by default)
+// through the options screen and plays its games back to back, retrying
+// from the game over screen. The bot jumps just before every edge the
+// player can't run onto, holding the button for a longer jump if a tap
+// would land in a gap, and in the air swaps the wheel to the color it will
+// land on. A game still going after the given simulated seconds (300 by
+// default) is ended with BB2.
+//
+// script plays a file of timed inputs instead, one per line:
+//
+//   <ms> s1|s2 down|up        BoosterPack button held or let go
+//   <ms> stick <direction>    center, up, down, left, right, up-left, ...
+//   <ms> stick <x> <y>        joystick position in ADC counts
+//   <ms> end                  stop here
+//
+// Times are from power on and must not go back; # starts a comment. Every
+// change of screen is printed as it happens.
+//
+// Both modes then report frames per second and LCD bytes per frame for
+// the passes that ran the game screen, the most the parallax layers needed
+// in one frame of any game against their budget, and the calls, host time
+// and board time of the functions in probes[]. Board time includes the LCD
+// traffic a function sends; host time only ranks CPU costs, it isn't the
+// MSP432's.
+
+#include <Application.h>
+#include <Sim.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+// The build renames the firmware's main so this one can drive it
+#undef main
+
+#define CYCLES_PER_US (SYSTEM_CLOCK / 1000000)
+#define CYCLES_PER_MS (SYSTEM_CLOCK / 1000)
+#define FLOOR_TICK_CYCLES ((uint64_t)PHYSICS_STEP_MS * CYCLES_PER_MS)
+
+// How far the bot pushes the stick from center
+#define STICK_PUSH 7500
+// Floor ticks between deciding to jump and leaving the floor: the button's
+// debounce and the pass that reads it
+#define JUMP_LEAD_TICKS 3
+// A game that hasn't ended this long after its limit means the bot is stuck
+#define STUCK_SECONDS 60
+
+static const char* stateNames[] = {
+    "TITLE", "MENU", "INSTRUCTIONS", "HIGHSCORE", "GAME", "OPTIONS", "GAMEOVER"
+};
+
+static HAL hal;
+static Application app;
+static uint64_t passCycles = 150 * CYCLES_PER_US;
+
+static double nowSeconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double seconds(uint64_t cycles) {
+  return (double)cycles / SYSTEM_CLOCK;
+}
+
+// Function timing, through -finstrument-functions. A probe counts the
+// outermost call only, so a function that recurses is timed once.
+
+typedef struct {
+  const char* name;
+  void* function;
+  int depth;
+  long calls;
+  uint64_t startCycles;
+  double startSeconds;
+  uint64_t cycles;
+  double hostSeconds;
+} Probe;
+
+#define PROBE(function) {#function, (void*)function}
+
+static Probe probes[] = {
+    PROBE(HAL_refresh),
+    PROBE(Application_loop),
+    PROBE(updateFloor),
+    PROBE(updateCharacter),
+    PROBE(checkPlayerFloorCollision),
+    PROBE(updateColorWheel),
+    PROBE(updateScore),
+    PROBE(drawFloor),
+    PROBE(Parallax_update),
+    PROBE(Sprites_flush),
+    PROBE(endGame),
+};
+
+#define PROBE_COUNT ((int)(sizeof(probes) / sizeof(probes[0])))
+
+static Probe* findProbe(void* function) {
+  int i;
+  for (i = 0; i < PROBE_COUNT; i++) {
+    if (probes[i].function == function) {
+      return &probes[i];
+    }
+  }
+  return NULL;
+}
+
+void __cyg_profile_func_enter(void* function, void* callSite) {
+  Probe* probe_p = findProbe(function);
+  if (probe_p != NULL && probe_p->depth++ == 0) {
+    probe_p->startCycles = SimBoard_cycles();
+    probe_p->startSeconds = nowSeconds();
+  }
+}
+
+void __cyg_profile_func_exit(void* function, void* callSite) {
+  Probe* probe_p = findProbe(function);
+  if (probe_p != NULL && --probe_p->depth == 0) {
+    probe_p->calls++;
+    probe_p->cycles += SimBoard_cycles() - probe_p->startCycles;
+    probe_p->hostSeconds += nowSeconds() - probe_p->startSeconds;
+  }
+}
+
+// What the passes of the game screen cost, and how the games went
+
+typedef struct {
+  long passes;      // game screen passes, not counting redraws of the whole screen
+  long frames;      // of those, the ones that sent anything to the LCD
+  uint64_t bytes;
+  long peakBytes;
+  long peakBackground;  // most the parallax layers marked in one frame
+  uint64_t cycles;
+  uint64_t peakCycles;
+  long overTick;    // passes longer than a floor tick
+  uint64_t gameCycles;
+  uint64_t boardCycles;  // simulated in all
+  int games;
+  int stopped;      // games the bot ended with BB2
+} Stats;
+
+static Stats stats;
+static uint64_t gameStart;
+static int* scores;  // one per game in stats
+static int scoreCapacity;
+
+static void recordScore(int score) {
+  if (stats.games == scoreCapacity) {
+    scoreCapacity = scoreCapacity > 0 ? 2 * scoreCapacity : 64;
+    scores = realloc(scores, scoreCapacity * sizeof(int));
+  }
+  scores[stats.games++] = score;
+}
+
+// Power on and set up as main does, without the LED polling
+static void boot(uint32_t seed) {
+  SimBoard_init(seed);
+  WDT_A_holdTimer();
+  InitSystemTiming();
+  uint32_t bootSeed = Random_bootSeed();
+  hal = HAL_construct();
+  Application_init(&app, bootSeed);
+}
+
+// One pass of main's loop, then the CPU time it took
+static void pass(void) {
+  AppState before = app.state;
+  bool redraw = app.screenNeedsRedraw;
+  uint64_t startCycles = SimBoard_cycles();
+  uint64_t startBytes = SimGraphics_bytes();
+
+  HAL_refresh(&hal);
+  Application_loop(&app, &hal);
+  SimBoard_run(passCycles);
+
+  uint64_t cycles = SimBoard_cycles() - startCycles;
+  long bytes = (long)(SimGraphics_bytes() - startBytes);
+
+  if (before == STATE_GAME && app.state == STATE_GAME && !redraw) {
+    stats.passes++;
+    stats.cycles += cycles;
+    if (cycles > stats.peakCycles) {
+      stats.peakCycles = cycles;
+    }
+    if (cycles > FLOOR_TICK_CYCLES) {
+      stats.overTick++;
+    }
+    if (bytes > 0) {
+      stats.frames++;
+      stats.bytes += bytes;
+      if (bytes > stats.peakBytes) {
+        stats.peakBytes = bytes;
+      }
+    }
+  }
+  if (before != STATE_GAME && app.state == STATE_GAME) {
+    gameStart = startCycles;
+  }
+  if (before == STATE_GAME && app.state == STATE_GAMEOVER) {
+    if (app.parallax.peakBytes > stats.peakBackground) {
+      stats.peakBackground = app.parallax.peakBytes;
+    }
+    stats.gameCycles += SimBoard_cycles() - gameStart;
+    recordScore(app.score);
+  }
+  stats.boardCycles = SimBoard_cycles();
+}
+
+// Where the stick goes for each direction, up and right being high
+static void stickToward(JoystickDirection direction) {
+  static const int offsets[][2] = {
+      {0, 0}, {0, 1}, {0, -1}, {-1, 0}, {1, 0}, {-1, 1}, {1, 1}, {-1, -1}, {1, -1}
+  };
+  SimBoard_setStick(JOYSTICK_CENTER + offsets[direction][0] * STICK_PUSH,
+                    JOYSTICK_CENTER + offsets[direction][1] * STICK_PUSH);
+}
+
+// The bot's hands. A press or push holds until the HAL has seen it, then
+// lets go and waits for the HAL to see that too, so each is one event.
+
+typedef enum { HAND_IDLE, HAND_HOLDING, HAND_LETTING_GO } HandPhase;
+
+typedef struct {
+  Button* button_p;
+  HandPhase phase;
+  uint64_t releaseAt;  // held at least until this cycle
+} Finger;
+
+static Finger jumpFinger;   // BB1
+static Finger endFinger;    // BB2
+static HandPhase thumbPhase;
+static JoystickDirection thumbDirection;
+
+// Press the button for at least ms
+static void Finger_hold(Finger* finger_p, int ms) {
+  if (finger_p->phase == HAND_IDLE) {
+    SimBoard_setButton(finger_p->button_p->port, finger_p->button_p->pin, true);
+    finger_p->phase = HAND_HOLDING;
+    finger_p->releaseAt = SimBoard_cycles() + (uint64_t)ms * CYCLES_PER_MS;
+  }
+}
+
+static void Finger_tap(Finger* finger_p) {
+  Finger_hold(finger_p, 0);
+}
+
+static void Finger_update(Finger* finger_p) {
+  if (finger_p->phase == HAND_HOLDING && Button_isPressed(finger_p->button_p) &&
+      SimBoard_cycles() >= finger_p->releaseAt) {
+    SimBoard_setButton(finger_p->button_p->port, finger_p->button_p->pin, false);
+    finger_p->phase = HAND_LETTING_GO;
+  } else if (finger_p->phase == HAND_LETTING_GO && !Button_isPressed(finger_p->button_p)) {
+    finger_p->phase = HAND_IDLE;
+  }
+}
+
+static void Thumb_push(JoystickDirection direction) {
+  if (thumbPhase == HAND_IDLE) {
+    stickToward(direction);
+    thumbDirection = direction;
+    thumbPhase = HAND_HOLDING;
+  }
+}
+
+static void Thumb_update(void) {
+  JoystickDirection held = Joystick_direction(&hal.joystick);
+  if (thumbPhase == HAND_HOLDING && held == thumbDirection) {
+    stickToward(JOYSTICK_NONE);
+    thumbPhase = HAND_LETTING_GO;
+  } else if (thumbPhase == HAND_LETTING_GO && held == JOYSTICK_NONE) {
+    thumbPhase = HAND_IDLE;
+  }
+}
+
+// The bot
+
+static int botMode;
+static int botGames;
+static uint64_t botLimitCycles;
+static int tapAirSteps;
+static int heldAirSteps;
+
+// The push that swaps color into the wheel's center
+static JoystickDirection slotOf(uint32_t color) {
+  const ColorWheel* wheel_p = &app.colorWheel;
+  if (wheel_p->up == color) return JOYSTICK_UP;
+  if (wheel_p->down == color) return JOYSTICK_DOWN;
+  if (wheel_p->left == color) return JOYSTICK_LEFT;
+  if (wheel_p->right == color) return JOYSTICK_RIGHT;
+  return JOYSTICK_NONE;
+}
+
+// Floor ticks from leaving the floor to landing, with the button held for
+// holdSteps of them
+static int airSteps(int holdSteps) {
+  Physics physics;
+  int steps = 0;
+
+  Physics_init(&physics, 0);
+  Physics_jump(&physics);
+  while (!physics.onGround) {
+    Physics_step(&physics, steps < holdSteps, true);
+    steps++;
+  }
+  return steps;
+}
+
+// Whether landing steps floor ticks from now is on a segment, or past what
+// has been generated so far
+static bool landsSafely(int steps, double speed) {
+  int x = app.playerCenterX + (int)(steps * speed);
+  const FloorSegment* landing = Floor_segmentAt(&app.floor, x);
+  return landing == NULL || landing->color != FLOOR_GAP_COLOR;
+}
+
+// On the floor, jump just before an edge the player can't run onto, holding
+// the button for a longer jump when a tap would come down in a gap. In the
+// air, swap to the color of the segment the player will land on, once it
+// has been generated.
+static void playGame(void) {
+  const Floor* floor_p = &app.floor;
+  int x = app.playerCenterX;
+  double speed = (double)app.floorParams.scrollSpeed / FIX16_ONE;
+  uint32_t center = app.colorWheel.center;
+
+  if (SimBoard_cycles() - gameStart > botLimitCycles) {
+    if (endFinger.phase == HAND_IDLE) {
+      stats.stopped++;
+    }
+    Finger_tap(&endFinger);
+    return;
+  }
+
+  if (app.playerPhysics.onGround) {
+    const FloorSegment* here = Floor_segmentAt(floor_p, x);
+    if (here == NULL || app.isFalling) {
+      return;
+    }
+    int edge = Floor_screenX(floor_p, here) + here->width;
+    const FloorSegment* next = Floor_segmentAt(floor_p, edge);
+    if (next != NULL && next->color != center && edge - x <= speed * JUMP_LEAD_TICKS + 1) {
+      if (landsSafely(tapAirSteps + JUMP_LEAD_TICKS, speed) ||
+          !landsSafely(heldAirSteps + JUMP_LEAD_TICKS, speed)) {
+        Finger_tap(&jumpFinger);
+      } else {
+        Finger_hold(&jumpFinger, PHYSICS_HOLD_STEPS * PHYSICS_STEP_MS);
+      }
+    }
+    return;
+  }
+
+  Physics ahead = app.playerPhysics;
+  int steps = 0;
+  while (!ahead.onGround && steps < 1000) {
+    Physics_step(&ahead, Button_isPressed(&hal.boosterpackS1), true);
+    steps++;
+  }
+  const FloorSegment* landing = Floor_segmentAt(floor_p, x + (int)(steps * speed));
+  if (landing != NULL && landing->color != FLOOR_GAP_COLOR && landing->color != center) {
+    Thumb_push(slotOf(landing->color));
+  }
+}
+
+// Work through the menus to a game of the bot's mode, then play
+static void botStep(void) {
+  Finger_update(&jumpFinger);
+  Finger_update(&endFinger);
+  Thumb_update();
+
+  switch (app.state) {
+    case STATE_MENU: {
+      Cursor target = app.difficulty == botMode ? CURSOR_0 : CURSOR_2;
+      if (app.arrow == target) {
+        Finger_tap(&jumpFinger);
+      } else {
+        Thumb_push(app.arrow > target ? JOYSTICK_UP : JOYSTICK_DOWN);
+      }
+      break;
+    }
+    case STATE_OPTIONS:
+      Finger_tap(app.difficulty == botMode ? &jumpFinger : &endFinger);
+      break;
+    case STATE_INSTRUCTIONS:
+    case STATE_HIGHSCORE:
+      Finger_tap(&jumpFinger);
+      break;
+    case STATE_GAME:
+      playGame();
+      break;
+    case STATE_GAMEOVER:
+      if (stats.games < botGames) {
+        Finger_tap(&jumpFinger);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+static bool runBot(int games, int mode, uint32_t seed, int limitSeconds) {
+  botGames = games;
+  botMode = mode;
+  botLimitCycles = (uint64_t)limitSeconds * SYSTEM_CLOCK;
+  tapAirSteps = airSteps(0);
+  heldAirSteps = airSteps(PHYSICS_HOLD_STEPS);
+  boot(seed);
+  jumpFinger.button_p = &hal.boosterpackS1;
+  endFinger.button_p = &hal.boosterpackS2;
+
+  uint64_t stuckCycles = (uint64_t)(limitSeconds + STUCK_SECONDS) * SYSTEM_CLOCK;
+  uint64_t lastEnd = SimBoard_cycles();
+  int ended = 0;
+  while (stats.games < games) {
+    pass();
+    botStep();
+    if (stats.games != ended) {
+      ended = stats.games;
+      lastEnd = SimBoard_cycles();
+    } else if (SimBoard_cycles() - lastEnd > stuckCycles) {
+      printf("stuck in %s at %.1f s after %d games\n", stateNames[app.state],
+             seconds(SimBoard_cycles()), stats.games);
+      return false;
+    }
+  }
+  return true;
+}
+
+// What a worker sends back
+typedef struct {
+  bool ok;
+  Stats stats;
+  long calls[PROBE_COUNT];
+  uint64_t cycles[PROBE_COUNT];
+  double hostSeconds[PROBE_COUNT];
+} WorkerResult;
+
+// Add a worker's results and its scores to this process's
+static void merge(const WorkerResult* result_p, const int* workerScores) {
+  const Stats* from = &result_p->stats;
+  int i;
+
+  stats.passes += from->passes;
+  stats.frames += from->frames;
+  stats.bytes += from->bytes;
+  stats.cycles += from->cycles;
+  stats.overTick += from->overTick;
+  stats.gameCycles += from->gameCycles;
+  stats.boardCycles += from->boardCycles;
+  stats.stopped += from->stopped;
+  if (from->peakBytes > stats.peakBytes) {
+    stats.peakBytes = from->peakBytes;
+  }
+  if (from->peakBackground > stats.peakBackground) {
+    stats.peakBackground = from->peakBackground;
+  }
+  if (from->peakCycles > stats.peakCycles) {
+    stats.peakCycles = from->peakCycles;
+  }
+  for (i = 0; i < from->games; i++) {
+    recordScore(workerScores[i]);
+  }
+  for (i = 0; i < PROBE_COUNT; i++) {
+    probes[i].calls += result_p->calls[i];
+    probes[i].cycles += result_p->cycles[i];
+    probes[i].hostSeconds += result_p->hostSeconds[i];
+  }
+}
+
+// Split the games between forked workers, each booting a board of its own
+// with the next seed, and gather what they found in shared memory
+static bool runWorkers(int games, int mode, uint32_t seed, int limitSeconds, int workers) {
+  size_t size = workers * sizeof(WorkerResult) + games * sizeof(int);
+  WorkerResult* results =
+      mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  int* allScores = (int*)(results + workers);
+  int first = 0;
+  int w, i;
+  bool ok = true;
+
+  if (results == MAP_FAILED) {
+    perror("mmap");
+    return false;
+  }
+  fflush(stdout);
+  for (w = 0; w < workers; w++) {
+    int share = games / workers + (w < games % workers ? 1 : 0);
+    pid_t pid = fork();
+    if (pid < 0) {
+      perror("fork");
+      return false;
+    }
+    if (pid == 0) {
+      WorkerResult* result_p = &results[w];
+      result_p->ok = runBot(share, mode, seed + w, limitSeconds);
+      result_p->stats = stats;
+      memcpy(allScores + first, scores, stats.games * sizeof(int));
+      for (i = 0; i < PROBE_COUNT; i++) {
+        result_p->calls[i] = probes[i].calls;
+        result_p->cycles[i] = probes[i].cycles;
+        result_p->hostSeconds[i] = probes[i].hostSeconds;
+      }
+      fflush(stdout);
+      _exit(0);
+    }
+    first += share;
+  }
+  while (wait(NULL) > 0) {
+  }
+
+  // A worker that crashed left its result zeroed, so not ok
+  first = 0;
+  for (w = 0; w < workers; w++) {
+    merge(&results[w], allScores + first);
+    ok = ok && results[w].ok;
+    first += games / workers + (w < games % workers ? 1 : 0);
+  }
+  munmap(results, size);
+  return ok;
+}
+
+// Script
+
+static bool parseDirection(const char* name, JoystickDirection* direction_p) {
+  static const char* names[] = {
+      "center", "up", "down", "left", "right", "up-left", "up-right", "down-left", "down-right"
+  };
+  int i;
+  for (i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++) {
+    if (strcmp(name, names[i]) == 0) {
+      *direction_p = (JoystickDirection)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Run passes until ms after power on, printing each change of screen
+static void runUntil(double ms) {
+  uint64_t until = (uint64_t)(ms * CYCLES_PER_MS);
+  while (SimBoard_cycles() < until) {
+    AppState before = app.state;
+    pass();
+    if (app.state != before) {
+      printf("%10.1f ms  %s", seconds(SimBoard_cycles()) * 1000, stateNames[app.state]);
+      if (app.state == STATE_GAMEOVER) {
+        printf(", score %d", app.score);
+      }
+      printf("\n");
+    }
+  }
+}
+
+static bool runScript(FILE* file, uint32_t seed) {
+  char line[128];
+  int number = 0;
+  double lastMs = 0;
+
+  boot(seed);
+  while (fgets(line, sizeof(line), file) != NULL) {
+    char what[16], arg1[16], arg2[16];
+    double ms;
+    number++;
+    char* comment = strchr(line, '#');
+    if (comment != NULL) {
+      *comment = '\0';
+    }
+    int fields = sscanf(line, "%lf %15s %15s %15s", &ms, what, arg1, arg2);
+    if (fields <= 0) {
+      continue;
+    }
+    if (fields < 2 || ms < lastMs) {
+      printf("line %d: expected a time no earlier than %.1f and an input\n", number, lastMs);
+      return false;
+    }
+    runUntil(ms);
+    lastMs = ms;
+
+    JoystickDirection direction;
+    if (strcmp(what, "end") == 0) {
+      return true;
+    } else if ((strcmp(what, "s1") == 0 || strcmp(what, "s2") == 0) && fields == 3 &&
+               (strcmp(arg1, "down") == 0 || strcmp(arg1, "up") == 0)) {
+      Button* button_p = what[1] == '1' ? &hal.boosterpackS1 : &hal.boosterpackS2;
+      SimBoard_setButton(button_p->port, button_p->pin, arg1[0] == 'd');
+    } else if (strcmp(what, "stick") == 0 && fields == 3 && parseDirection(arg1, &direction)) {
+      stickToward(direction);
+    } else if (strcmp(what, "stick") == 0 && fields == 4) {
+      SimBoard_setStick(atoi(arg1), atoi(arg2));
+    } else {
+      printf("line %d: unknown input\n", number);
+      return false;
+    }
+  }
+  // No end line: give the last input a second to play out
+  runUntil(lastMs + 1000);
+  return true;
+}
+
+// Report
+
+static int compareInts(const void* a, const void* b) {
+  return *(const int*)a - *(const int*)b;
+}
+
+static void report(double hostSeconds, bool perMinute) {
+  double gameSeconds = seconds(stats.gameCycles);
+  int i;
+
+  printf("simulated %.1f s in %.2f s of host time, pass cost %.0f us\n",
+         seconds(stats.boardCycles), hostSeconds, (double)passCycles / CYCLES_PER_US);
+  if (stats.games > 0) {
+    long total = 0;
+    qsort(scores, stats.games, sizeof(int), compareInts);
+    for (i = 0; i < stats.games; i++) {
+      total += scores[i];
+    }
+    printf("games     %d", stats.games);
+    if (perMinute) {
+      printf(", %.0f a minute", stats.games * 60 / hostSeconds);
+    }
+    printf("; score mean %.1f, median %d, max %d\n", (double)total / stats.games,
+           scores[stats.games / 2], scores[stats.games - 1]);
+  }
+  if (stats.passes == 0) {
+    printf("the game screen never ran\n");
+    return;
+  }
+  if (gameSeconds <= 0) {
+    gameSeconds = seconds(stats.cycles);
+  }
+  printf("loop      %.0f passes/s on the game screen, %.1f frames/s drew something\n",
+         stats.passes / gameSeconds, stats.frames / gameSeconds);
+  printf("pass      mean %.0f us, peak %.0f us; %ld longer than a %d ms floor tick\n",
+         (double)stats.cycles / stats.passes / CYCLES_PER_US,
+         (double)stats.peakCycles / CYCLES_PER_US, stats.overTick, PHYSICS_STEP_MS);
+  if (stats.frames > 0) {
+    printf("LCD       mean %.0f B, peak %ld B a frame\n", (double)stats.bytes / stats.frames,
+           stats.peakBytes);
+  }
+  if (stats.games > 0) {
+    printf("parallax  peak %ld B a frame against a %d B budget\n", stats.peakBackground,
+           PARALLAX_BUDGET_BYTES);
+  }
+
+  // Built without -finstrument-functions, nothing was timed
+  if (probes[0].calls == 0) {
+    return;
+  }
+  printf("\n%-26s %10s %14s %14s\n", "function", "calls", "host ns/call", "board us/call");
+  for (i = 0; i < PROBE_COUNT; i++) {
+    const Probe* probe_p = &probes[i];
+    if (probe_p->calls == 0) {
+      printf("%-26s %10d\n", probe_p->name, 0);
+      continue;
+    }
+    printf("%-26s %10ld %14.0f %14.1f\n", probe_p->name, probe_p->calls,
+           probe_p->hostSeconds * 1e9 / probe_p->calls,
+           (double)probe_p->cycles / probe_p->calls / CYCLES_PER_US);
+  }
+}
+
+// A mode by number or by the start of its name
+static int parseMode(const char* text) {
+  int m;
+  if (isdigit((unsigned char)text[0])) {
+    m = atoi(text);
+    return m < difficultyModeCount ? m : -1;
+  }
+  for (m = 0; m < difficultyModeCount; m++) {
+    if (strncasecmp(difficultyModes[m].name, text, strlen(text)) == 0) {
+      return m;
+    }
+  }
+  return -1;
+}
+
+static int usage(void) {
+  printf("usage: colorjump_sim [-c pass us] [-j workers] bot [games] [mode] [seed] [seconds]\n"
+         "       colorjump_sim [-c pass us] script <file or -> [seed]\n");
+  return 2;
+}
+
+int main(int argc, char** argv) {
+  int workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  int arg = 1;
+  bool ok;
+
+  while (arg + 1 < argc && argv[arg][0] == '-' && argv[arg][1] != '\0') {
+    if (strcmp(argv[arg], "-c") == 0) {
+      passCycles = (uint64_t)(atof(argv[arg + 1]) * CYCLES_PER_US);
+    } else if (strcmp(argv[arg], "-j") == 0) {
+      workers = atoi(argv[arg + 1]);
+    } else {
+      return usage();
+    }
+    arg += 2;
+  }
+  if (arg >= argc) {
+    return usage();
+  }
+
+  const char* command = argv[arg++];
+  bool bot = strcmp(command, "bot") == 0;
+  int rest = argc - arg;
+  double start = nowSeconds();
+
+  if (bot) {
+    int games = rest > 0 ? atoi(argv[arg]) : 1000;
+    int mode = rest > 1 ? parseMode(argv[arg + 1]) : 0;
+    uint32_t seed = rest > 2 ? (uint32_t)strtoul(argv[arg + 2], NULL, 0) : 1;
+    int limit = rest > 3 ? atoi(argv[arg + 3]) : 300;
+    if (games < 1 || mode < 0 || limit < 1) {
+      return usage();
+    }
+    if (workers < 1) {
+      workers = 1;
+    }
+    if (workers > games) {
+      workers = games;
+    }
+    ok = workers > 1 ? runWorkers(games, mode, seed, limit, workers)
+                     : runBot(games, mode, seed, limit);
+    printf("%d games of %s from seed %lu on %d worker%s: %d fell, %d ended with BB2 at %d s\n",
+           stats.games, difficultyModes[mode].name, (unsigned long)seed, workers,
+           workers > 1 ? "s" : "", stats.games - stats.stopped, stats.stopped, limit);
+  } else if (strcmp(command, "script") == 0 && rest > 0) {
+    FILE* file = strcmp(argv[arg], "-") == 0 ? stdin : fopen(argv[arg], "r");
+    uint32_t seed = rest > 1 ? (uint32_t)strtoul(argv[arg + 1], NULL, 0) : 1;
+    if (file == NULL) {
+      printf("can't open %s\n", argv[arg]);
+      return 1;
+    }
+    ok = runScript(file, seed);
+  } else {
+    return usage();
+  }
+
+  report(nowSeconds() - start, bot);
+  return ok ? 0 : 1;
+}